@@ -0,0 +1,41 @@
+#ifndef SRC_ALLOCATOR_HOLDER_H_
+#define SRC_ALLOCATOR_HOLDER_H_
+
+#include <type_traits>
+
+namespace s21 {
+
+// Keeps the allocator of a container that derives from it. An allocator
+// without state, as std::allocator, becomes an empty base and takes no room
+// in the container.
+template <typename Allocator,
+          bool = std::is_empty_v<Allocator> && !std::is_final_v<Allocator>>
+class AllocatorHolder : private Allocator {
+ public:
+  AllocatorHolder() {}
+  explicit AllocatorHolder(const Allocator& allocator)
+      : Allocator(allocator) {}
+
+ protected:
+  Allocator& StoredAllocator() { return *this; }
+  const Allocator& StoredAllocator() const { return *this; }
+};
+
+template <typename Allocator>
+class AllocatorHolder<Allocator, false> {
+ public:
+  AllocatorHolder() {}
+  explicit AllocatorHolder(const Allocator& allocator)
+      : allocator_ {allocator} {}
+
+ protected:
+  Allocator& StoredAllocator() { return allocator_; }
+  const Allocator& StoredAllocator() const { return allocator_; }
+
+ private:
+  Allocator allocator_{};
+};
+
+}  // namespace s21
+
+#endif  // SRC_ALLOCATOR_HOLDER_H_
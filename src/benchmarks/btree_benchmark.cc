@@ -0,0 +1,52 @@
+// Random lookups in a map of random int keys against int values: Map, a
+// red-black tree with one node per value, against BTreeMap, which packs
+// the values of each node into about 256 contiguous bytes.
+
+#include <chrono>
+#include <cstdio>
+
+#include "s21_btree_map.h"
+#include "s21_map.h"
+
+namespace {
+
+constexpr int kLookups {2000000};
+
+// keeps the lookups from being optimized away
+volatile int sink {0};
+
+unsigned Next(unsigned* state) {
+  *state = *state * 1103515245 + 12345;
+  return *state >> 4;
+}
+
+// nanoseconds per Contains on a map of size random keys
+template <typename MapType>
+double Lookup(int size) {
+  MapType map{};
+  unsigned state {1};
+  for (int i {0}; i < size; ++i) {
+    map.Insert(static_cast<int>(Next(&state)), i);
+  }
+  int found {0};
+  state = 7;
+  auto start {std::chrono::steady_clock::now()};
+  for (int i {0}; i < kLookups; ++i) {
+    found += map.Contains(static_cast<int>(Next(&state)));
+  }
+  std::chrono::duration<double> elapsed {std::chrono::steady_clock::now() -
+                                         start};
+  sink = found;
+  return elapsed.count() * 1e9 / kLookups;
+}
+
+}  // namespace
+
+int main() {
+  std::printf("%-10s %18s %12s\n", "ns/lookup", "Map (red-black)", "BTreeMap");
+  for (int size : {100000, 1000000, 4000000}) {
+    std::printf("%-10d %18.1f %12.1f\n", size, Lookup<s21::Map<int, int>>(size),
+                Lookup<s21::BTreeMap<int, int>>(size));
+  }
+  return 0;
+}
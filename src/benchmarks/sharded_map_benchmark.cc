@@ -0,0 +1,86 @@
+// Throughput of ShardedMap against a Map behind one mutex, for 1 to 32
+// threads running a 90% lookup, 10% insert mix on random keys.
+
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "s21_map.h"
+#include "s21_sharded_map.h"
+
+namespace {
+
+constexpr int kKeyRange {1 << 20};
+constexpr int kOperationsPerThread {1 << 19};
+
+class LockedMap {
+ public:
+  bool Insert(int key, int value) {
+    std::lock_guard<std::mutex> lock {mutex_};
+    return map_.Insert(key, value).second;
+  }
+  bool Contains(int key) {
+    std::lock_guard<std::mutex> lock {mutex_};
+    return map_.Contains(key);
+  }
+
+ private:
+  std::mutex mutex_{};
+  s21::Map<int, int> map_{};
+};
+
+template <typename MapType>
+double Run(MapType* map, int thread_count) {
+  std::vector<std::thread> threads{};
+  auto start {std::chrono::steady_clock::now()};
+  for (int t {0}; t < thread_count; ++t) {
+    threads.emplace_back([map, t]() {
+      unsigned state {static_cast<unsigned>(t) + 1};
+      int found {0};
+      for (int i {0}; i < kOperationsPerThread; ++i) {
+        state = state * 1103515245 + 12345;
+        int key {static_cast<int>((state >> 8) % kKeyRange)};
+        if (state % 10 == 0) {
+          map->Insert(key, i);
+        } else {
+          found += map->Contains(key);
+        }
+      }
+      if (found < 0) {
+        std::printf("unreachable\n");
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  std::chrono::duration<double> elapsed {std::chrono::steady_clock::now() -
+                                         start};
+  return thread_count * kOperationsPerThread / elapsed.count() / 1e6;
+}
+
+template <typename MapType>
+void Prefill(MapType* map) {
+  for (int key {0}; key < kKeyRange; key += 2) {
+    map->Insert(key, key);
+  }
+}
+
+}  // namespace
+
+int main() {
+  std::printf("hardware threads: %u\n", std::thread::hardware_concurrency());
+  std::printf("%8s %16s %16s\n", "threads", "one mutex Mop/s", "sharded Mop/s");
+  for (int thread_count : {1, 2, 4, 8, 16, 32}) {
+    LockedMap locked{};
+    s21::ShardedMap<int, int> sharded{};
+    Prefill(&locked);
+    Prefill(&sharded);
+    double locked_rate {Run(&locked, thread_count)};
+    double sharded_rate {Run(&sharded, thread_count)};
+    std::printf("%8d %16.2f %16.2f\n", thread_count, locked_rate,
+                sharded_rate);
+  }
+}
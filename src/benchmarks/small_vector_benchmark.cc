@@ -0,0 +1,138 @@
+// Short-lived vectors of a few ints, as built per request: SmallVector<int, 8>
+// against Vector<int> and std::vector<int>. Reports heap allocations per
+// vector, counted through an allocator, and the time to fill, read and
+// destroy one vector with the default allocators.
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+#include "s21_small_vector.h"
+#include "s21_vector.h"
+
+namespace {
+
+constexpr int kRepeats {5};
+constexpr int kVectors {1000000};
+constexpr std::size_t kInline {8};
+
+long long allocations {0};
+
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+  CountingAllocator() = default;
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U>&) {}
+  T* allocate(std::size_t n) {
+    ++allocations;
+    return std::allocator<T>{}.allocate(n);
+  }
+  void deallocate(T* items, std::size_t n) {
+    std::allocator<T>{}.deallocate(items, n);
+  }
+  bool operator==(const CountingAllocator&) const { return true; }
+  bool operator!=(const CountingAllocator&) const { return false; }
+};
+
+// the same operations spelled for every vector
+template <typename Vector>
+struct S21Ops {
+  using Container = Vector;
+  static void PushBack(Container* vector, int value) {
+    vector->PushBack(value);
+  }
+  static long long Sum(const Container& vector) {
+    long long sum {0};
+    for (auto value : vector) {
+      sum += value;
+    }
+    return sum;
+  }
+};
+
+template <typename Vector>
+struct StdOps {
+  using Container = Vector;
+  static void PushBack(Container* vector, int value) {
+    vector->push_back(value);
+  }
+  static long long Sum(const Container& vector) {
+    long long sum {0};
+    for (auto value : vector) {
+      sum += value;
+    }
+    return sum;
+  }
+};
+
+// builds kVectors vectors of size elements and returns a checksum
+template <typename Ops>
+long long Workload(int size) {
+  long long checksum {0};
+  for (int i {0}; i < kVectors; ++i) {
+    typename Ops::Container vector{};
+    for (int j {0}; j < size; ++j) {
+      Ops::PushBack(&vector, i + j);
+    }
+    checksum += Ops::Sum(vector);
+  }
+  return checksum;
+}
+
+template <typename Ops>
+double AllocationsPerVector(int size) {
+  allocations = 0;
+  Workload<Ops>(size);
+  return static_cast<double>(allocations) / kVectors;
+}
+
+// best of kRepeats runs, in nanoseconds per vector
+template <typename Ops>
+double Latency(int size) {
+  double best {0};
+  long long checksum {0};
+  for (int repeat {0}; repeat < kRepeats; ++repeat) {
+    auto start {std::chrono::steady_clock::now()};
+    checksum += Workload<Ops>(size);
+    std::chrono::duration<double, std::nano> elapsed {
+        std::chrono::steady_clock::now() - start};
+    double latency {elapsed.count() / kVectors};
+    best = repeat == 0 || latency < best ? latency : best;
+  }
+  if (checksum == 0) {
+    std::printf("unreachable\n");
+  }
+  return best;
+}
+
+using SmallOps = S21Ops<s21::SmallVector<int, kInline>>;
+using VectorOps = S21Ops<s21::Vector<int>>;
+using StdVectorOps = StdOps<std::vector<int>>;
+using CountedSmallOps =
+    S21Ops<s21::SmallVector<int, kInline, CountingAllocator<int>>>;
+using CountedVectorOps = S21Ops<s21::Vector<int, CountingAllocator<int>>>;
+using CountedStdVectorOps =
+    StdOps<std::vector<int, CountingAllocator<int>>>;
+
+}  // namespace
+
+int main() {
+  std::printf("%-24s %12s %12s %12s\n", "allocations per vector",
+              "SmallVector", "s21::Vector", "std::vector");
+  for (int size : {1, 4, 8, 16, 64}) {
+    std::printf("size %-19d %12.2f %12.2f %12.2f\n", size,
+                AllocationsPerVector<CountedSmallOps>(size),
+                AllocationsPerVector<CountedVectorOps>(size),
+                AllocationsPerVector<CountedStdVectorOps>(size));
+  }
+  std::printf("%-24s %12s %12s %12s\n", "ns per vector", "SmallVector",
+              "s21::Vector", "std::vector");
+  for (int size : {1, 4, 8, 16, 64}) {
+    std::printf("size %-19d %12.1f %12.1f %12.1f\n", size,
+                Latency<SmallOps>(size), Latency<VectorOps>(size),
+                Latency<StdVectorOps>(size));
+  }
+  return 0;
+}
@@ -0,0 +1,87 @@
+// Insert/erase churn on Set, Map and Multiset: 200k random inserts and
+// 100k Erase(begin()) per round, 5 rounds. Reports the time and the number
+// of global operator new calls per operation, which shows how often the
+// node pool has to go back to the heap.
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#include "s21_map.h"
+#include "s21_multiset.h"
+#include "s21_set.h"
+
+namespace {
+
+constexpr int kRounds {5};
+constexpr int kInserts {200000};
+constexpr int kErases {100000};
+
+std::atomic<long> allocations {0};
+
+}  // namespace
+
+void* operator new(std::size_t size) {
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  void* block {std::malloc(size == 0 ? 1 : size)};
+  if (block == nullptr) {
+    throw std::bad_alloc{};
+  }
+  return block;
+}
+
+void operator delete(void* block) noexcept { std::free(block); }
+
+void operator delete(void* block, std::size_t) noexcept { std::free(block); }
+
+namespace {
+
+// the same operations spelled for each container
+struct SetOps {
+  using Container = s21::Set<int>;
+  static void Insert(Container* tree, int key) { tree->Insert(key); }
+};
+
+struct MapOps {
+  using Container = s21::Map<int, int>;
+  static void Insert(Container* tree, int key) { tree->Insert(key, key); }
+};
+
+struct MultisetOps {
+  using Container = s21::Multiset<int>;
+  static void Insert(Container* tree, int key) { tree->Insert(key); }
+};
+
+template <typename Ops>
+void Churn(const char* name) {
+  typename Ops::Container tree{};
+  unsigned state {1};
+  long start_allocations {allocations.load()};
+  auto start {std::chrono::steady_clock::now()};
+  for (int round {0}; round < kRounds; ++round) {
+    for (int i {0}; i < kInserts; ++i) {
+      state = state * 1103515245 + 12345;
+      Ops::Insert(&tree, static_cast<int>((state >> 8) % (kInserts * 4)));
+    }
+    for (int i {0}; i < kErases && !tree.Empty(); ++i) {
+      tree.Erase(tree.begin());
+    }
+  }
+  std::chrono::duration<double> elapsed {std::chrono::steady_clock::now() -
+                                         start};
+  double operations {static_cast<double>(kRounds) * (kInserts + kErases)};
+  std::printf("%-10s %12.1f %16.6f\n", name, elapsed.count() * 1e9 / operations,
+              (allocations.load() - start_allocations) / operations);
+}
+
+}  // namespace
+
+int main() {
+  std::printf("%-10s %12s %16s\n", "", "ns/op", "operator new/op");
+  Churn<SetOps>("Set");
+  Churn<MapOps>("Map");
+  Churn<MultisetOps>("Multiset");
+  return 0;
+}
@@ -0,0 +1,111 @@
+// PushBack, Insert and Erase throughput of Vector<int> against
+// std::vector<int>, which exercises the memmove and realloc path taken for
+// trivially copyable elements.
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include "s21_vector.h"
+
+namespace {
+
+constexpr int kRepeats {5};
+
+// the same operations spelled for both vectors
+struct S21Ops {
+  using Container = s21::Vector<int>;
+  static void PushBack(Container* vector, int value) {
+    vector->PushBack(value);
+  }
+  static void Insert(Container* vector, std::size_t index, int value) {
+    vector->Insert(vector->begin() + index, value);
+  }
+  static void Erase(Container* vector, std::size_t index) {
+    vector->Erase(vector->begin() + index);
+  }
+  static std::size_t Size(const Container& vector) { return vector.Size(); }
+};
+
+struct StdOps {
+  using Container = std::vector<int>;
+  static void PushBack(Container* vector, int value) {
+    vector->push_back(value);
+  }
+  static void Insert(Container* vector, std::size_t index, int value) {
+    vector->insert(vector->begin() + index, value);
+  }
+  static void Erase(Container* vector, std::size_t index) {
+    vector->erase(vector->begin() + index);
+  }
+  static std::size_t Size(const Container& vector) { return vector.size(); }
+};
+
+// best of kRepeats runs, in millions of operations per second
+template <typename Body>
+double Throughput(int operations, Body body) {
+  double best {0};
+  for (int repeat {0}; repeat < kRepeats; ++repeat) {
+    auto start {std::chrono::steady_clock::now()};
+    body();
+    std::chrono::duration<double> elapsed {std::chrono::steady_clock::now() -
+                                           start};
+    double rate {operations / elapsed.count() / 1e6};
+    best = rate > best ? rate : best;
+  }
+  return best;
+}
+
+template <typename Ops>
+double PushBack(int count) {
+  return Throughput(count, [count]() {
+    typename Ops::Container vector{};
+    for (int i {0}; i < count; ++i) {
+      Ops::PushBack(&vector, i);
+    }
+    if (Ops::Size(vector) == 0) {
+      std::printf("unreachable\n");
+    }
+  });
+}
+
+template <typename Ops>
+double InsertMiddle(int count) {
+  return Throughput(count, [count]() {
+    typename Ops::Container vector{};
+    for (int i {0}; i < count; ++i) {
+      Ops::Insert(&vector, Ops::Size(vector) / 2, i);
+    }
+  });
+}
+
+template <typename Ops>
+double EraseFront(int count) {
+  typename Ops::Container filled{};
+  for (int i {0}; i < count; ++i) {
+    Ops::PushBack(&filled, i);
+  }
+  return Throughput(count, [count, &filled]() {
+    typename Ops::Container vector {filled};
+    for (int i {0}; i < count; ++i) {
+      Ops::Erase(&vector, 0);
+    }
+  });
+}
+
+}  // namespace
+
+int main() {
+  std::printf("%-28s %12s %12s\n", "Mop/s", "s21::Vector", "std::vector");
+  for (int count : {1000, 1000000, 10000000}) {
+    std::printf("PushBack x %-17d %12.1f %12.1f\n", count,
+                PushBack<S21Ops>(count), PushBack<StdOps>(count));
+  }
+  for (int count : {1000, 30000}) {
+    std::printf("Insert middle x %-13d %12.2f %12.2f\n", count,
+                InsertMiddle<S21Ops>(count), InsertMiddle<StdOps>(count));
+    std::printf("Erase front x %-15d %12.2f %12.2f\n", count,
+                EraseFront<S21Ops>(count), EraseFront<StdOps>(count));
+  }
+  return 0;
+}
@@ -1,94 +1,311 @@
 #ifndef SRC_BINARY_SEARCH_TREE_H_
 #define SRC_BINARY_SEARCH_TREE_H_
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <initializer_list>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
 #include <utility>
 
+#include "node_pool.h"
+#include "s21_vector.h"
+
 namespace s21 {
 
+// How many elements one stored value stands for. Trees of counted values
+// specialise it, so that subtree sizes count every occurrence.
 template <typename T>
+struct TreeValueWeight {
+  static std::size_t Of(const T&) { return 1; }
+};
+
+template <typename T, typename Compare = std::less<T>,
+          typename Allocator = std::allocator<T>>
 class BinarySearchTree {
  public:
   using SizeType = std::size_t;
   class BinarySearchTreeIterator;
   using Iterator = BinarySearchTreeIterator;
   using ConstIterator = BinarySearchTreeIterator;
+  using ReverseIterator = std::reverse_iterator<Iterator>;
+  using AllocatorType = Allocator;
   BinarySearchTree() {}
-  explicit BinarySearchTree(std::initializer_list<T> const& items);
-  BinarySearchTree(const BinarySearchTree& other) { *this = other; }
-  BinarySearchTree(BinarySearchTree&& other) { *this = std::move(other); }
+  explicit BinarySearchTree(const Allocator& allocator)
+      : pool_ {NodeAllocator(allocator)} {}
+  explicit BinarySearchTree(std::initializer_list<T> const& items,
+                            const Allocator& allocator = Allocator());
+  template <typename InputIt>
+  BinarySearchTree(InputIt first, InputIt last,
+                   const Allocator& allocator = Allocator())
+      : pool_ {NodeAllocator(allocator)} {
+    AssignSorted(first, last);
+  }
+  BinarySearchTree(const BinarySearchTree& other);
+  BinarySearchTree(BinarySearchTree&& other)
+      : pool_ {other.pool_.GetAllocator()} {
+    *this = std::move(other);
+  }
   BinarySearchTree& operator=(const BinarySearchTree& other);
   BinarySearchTree& operator=(BinarySearchTree&& other);
   ~BinarySearchTree() { Clear(); }
-  Iterator begin() const { return Iterator(this, MinimumNode(root_)); }
-  Iterator end() const { return Iterator(this, nullptr); }
+  Allocator GetAllocator() const { return Allocator(pool_.GetAllocator()); }
+  Iterator begin() const { return MakeIterator(header_.left_child); }
+  Iterator end() const { return Iterator(&header_); }
+  ReverseIterator rbegin() const { return ReverseIterator(end()); }
+  ReverseIterator rend() const { return ReverseIterator(begin()); }
   Iterator Insert(const T& value);
+  // a right hint saves the descent, but keeping the subtree sizes for Rank
+  // and Select still walks from the new node up to the root, so a hinted
+  // insert is O(log n) and not amortized O(1)
+  Iterator Insert(Iterator hint, const T& value);
+  template <typename... Args>
+  Iterator EmplaceHint(Iterator hint, Args&&... args);
   Iterator Find(const T& key) const;
+  template <typename Key, typename C = Compare,
+            typename = typename C::is_transparent>
+  Iterator Find(const Key& key) const { return MakeIterator(FindNode(key)); }
   void Erase(Iterator pos);
+  Iterator Erase(Iterator first, Iterator last);
+  SizeType Erase(const T& key);
+  template <typename Predicate>
+  SizeType EraseIf(Predicate pred);
   void Swap(BinarySearchTree& other);  // NOLINT(runtime/references)
+  BinarySearchTree Split(const T& key);
+  void Join(BinarySearchTree& other);  // NOLINT(runtime/references)
   void Clear();
-  bool Contains(const T& key) const { return Find(key) != this->end(); }
+  template <typename InputIt>
+  void AssignSorted(InputIt first, InputIt last);
+  bool Contains(const T& key) const { return FindNode(key) != nullptr; }
+  template <typename Key, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool Contains(const Key& key) const { return FindNode(key) != nullptr; }
+  SizeType Rank(const T& key) const { return RankOf(key); }
+  template <typename Key, typename C = Compare,
+            typename = typename C::is_transparent>
+  SizeType Rank(const Key& key) const { return RankOf(key); }
+  Iterator Select(SizeType index) const;
+  SizeType CountRange(const T& low, const T& high) const {
+    return CountRangeOf(low, high);
+  }
+  template <typename Key, typename C = Compare,
+            typename = typename C::is_transparent>
+  SizeType CountRange(const Key& low, const Key& high) const {
+    return CountRangeOf(low, high);
+  }
   bool Empty() const { return Size() == 0; }
   SizeType Size() const { return tree_size_; }
   SizeType MaxSize() const { return std::numeric_limits<SizeType>::max(); }
 
  protected:
-  struct Node {
-    Node* parent{};
+  enum class Color : std::uintptr_t { kRed = 0, kBlack = 1 };
+  struct Node;
+  // Links shared by the nodes and the tree header. The colour is kept in the
+  // lowest bit of the parent pointer and the header is marked by the next
+  // one, both bits are always zero because of the node alignment.
+  struct NodeBase {
+    static constexpr std::uintptr_t kColorMask {1};
+    static constexpr std::uintptr_t kHeaderMask {2};
+    NodeBase* ParentBase() const {
+      return reinterpret_cast<NodeBase*>(parent_and_color &
+                                         ~(kColorMask | kHeaderMask));
+    }
+    bool IsHeader() const { return (parent_and_color & kHeaderMask) != 0; }
+    std::uintptr_t parent_and_color{};
     Node* left_child{};
     Node* right_child{};
+  };
+  struct Node : NodeBase {
+    // the root links up to the header, which is reported as no parent
+    Node* Parent() const {
+      NodeBase* parent {this->ParentBase()};
+      return parent->IsHeader() ? nullptr : static_cast<Node*>(parent);
+    }
+    void SetParent(NodeBase* parent) {
+      this->parent_and_color = reinterpret_cast<std::uintptr_t>(parent) |
+                               (this->parent_and_color & this->kColorMask);
+    }
+    Color GetColor() const {
+      return static_cast<Color>(this->parent_and_color & this->kColorMask);
+    }
+    void SetColor(Color color) {
+      this->parent_and_color = (this->parent_and_color & ~this->kColorMask) |
+                               static_cast<std::uintptr_t>(color);
+    }
     T value{};
+    // total weight of the subtree rooted here, for rank and select
+    SizeType subtree_size {1};
+  };
+  using NodeAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using NodeTraits = std::allocator_traits<NodeAllocator>;
+  // scratch lists of nodes draw on the tree's allocator too
+  using NodeVector = Vector<
+      Node*,
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node*>>;
+  static bool IsRed(const Node* node) {
+    return node != nullptr && node->GetColor() == Color::kRed;
+  }
+  static SizeType SubtreeSize(const Node* node) {
+    return node == nullptr ? 0 : node->subtree_size;
+  }
+  static SizeType Weight(const Node* node) {
+    return TreeValueWeight<T>::Of(node->value);
+  }
+  // the node behind an iterator position, nullptr for end()
+  static Node* ToNode(NodeBase* node) {
+    return node->IsHeader() ? nullptr : static_cast<Node*>(node);
+  }
+  Iterator MakeIterator(Node* node) const {
+    return Iterator(node != nullptr ? node : &header_);
+  }
+  // Where a new node goes: under parent on the given side, or nowhere if an
+  // equal element match already exists in a tree with unique values.
+  struct InsertPosition {
+    Node* parent{};
+    bool left_child{};
+    Node* match{};
+  };
+  enum class SetOperation {
+    kUnion,
+    kIntersection,
+    kDifference,
+    kSymmetricDifference
   };
-  void MoveNodeFromOtherTree(Iterator other_pos, BinarySearchTree& other);  // NOLINT(runtime/references)
+  template <typename OnEqual>
+  void MergeFrom(BinarySearchTree& other, OnEqual on_equal);  // NOLINT(runtime/references)
+  void MoveTakenNodes(const NodeVector& taken, NodeVector* merged);
+  void AssignMerged(const BinarySearchTree& lhs, const BinarySearchTree& rhs,
+                    SetOperation operation);
+  template <typename InputIt>
+  void AssignRange(InputIt first, InputIt last, bool unique);
+  Iterator InsertNodeWithHint(Iterator hint, Node* node, bool unique);
+  void LinkNode(Node* node, const InsertPosition& position);
+  template <typename Key>
+  Node* LowerBoundNode(const Key& key) const;
+  template <typename Key>
+  Node* UpperBoundNode(const Key& key) const;
+  template <typename Key>
+  Node* FindNode(const Key& key) const;
+  template <typename Key>
+  InsertPosition FindInsertPosition(const Key& key, bool unique) const;
+  template <typename Key>
+  bool FindHintPosition(Node* hint, const Key& key, bool unique,
+                        InsertPosition* position) const;
+  Node* SelectNode(SizeType* index) const;
+  Node* Successor(Node* node) const;
+  Node* Predecessor(Node* node) const;
+  SizeType EraseRange(Node* first, Node* last);
+  template <typename Key>
+  void SplitInto(const Key& key, BinarySearchTree* rest);
+  void JoinWith(BinarySearchTree& other, bool unique);  // NOLINT(runtime/references)
+  void GrowPath(Node* node, SizeType weight);
+  void ShrinkPath(Node* node, SizeType weight);
+  template <typename Key>
+  SizeType RankOf(const Key& key) const;
+  template <typename Key>
+  SizeType UpperRankOf(const Key& key) const;
+  template <typename Key>
+  SizeType CountRangeOf(const Key& low, const Key& high) const;
   Node* root_{};
+  // end() position: its children cache the leftmost and rightmost nodes and
+  // the root's parent link points at it
+  mutable NodeBase header_ {NodeBase::kHeaderMask};
   SizeType tree_size_{};
+  NodePool<Node, NodeAllocator> pool_{};
+  Compare compare_{};
+  // an erase that leaves at most 1 / kRebuildRatio of the nodes rebuilds
+  // the tree from the survivors instead of relinking around every erased node
+  static constexpr SizeType kRebuildRatio {4};
+  // merging a tree at least 1 / kMergeRatio of this size walks both trees
+  // together and rebuilds, smaller ones are inserted node by node
+  static constexpr SizeType kMergeRatio {2};
+  // a merge relinks the nodes it takes from the other tree, which makes the
+  // pools share their chunks, only when it takes at least 1 / kAdoptRatio
+  // of them; fewer are moved into nodes of this pool so that the chunks of
+  // a tree left mostly in place are not kept alive by this one
+  static constexpr SizeType kAdoptRatio {2};
 
  private:
   void InsertNode(Node* node_to_insert);
-  Node* Successor(Node* node) const;
-  Node* Predecessor(Node* node) const;
-  Node* MaximumNode(Node* subtree) const;
-  Node* MinimumNode(Node* subtree) const;
+  static NodeBase* NextNode(NodeBase* node);
+  static NodeBase* PreviousNode(NodeBase* node);
+  static Node* MaximumNode(Node* subtree);
+  static Node* MinimumNode(Node* subtree);
+  void SwapRoots(BinarySearchTree& other);  // NOLINT(runtime/references)
+  void CopyFrom(const BinarySearchTree& other);
+  void MoveValuesFrom(BinarySearchTree& other);  // NOLINT(runtime/references)
+  // whether nodes of other may be linked into this tree as they are
+  bool CanAdoptNodes(const BinarySearchTree& other) const {
+    return NodeTraits::is_always_equal::value ||
+           pool_.GetAllocator() == other.pool_.GetAllocator();
+  }
+  void CopySubtree(const Node* source, NodeBase* parent, Node** link);
+  bool IsBulkErase(SizeType count) const {
+    return (tree_size_ - count) * kRebuildRatio <= tree_size_;
+  }
+  void UnlinkNodes(const NodeVector& doomed);
+  void RebuildWithout(const NodeVector& doomed,
+                      const NodeVector& survivors);
+  void LinkSorted(const NodeVector& nodes);
+  Node* BuildBalanced(Node* const* nodes, SizeType count, NodeBase* parent,
+                      SizeType depth, SizeType red_depth);
   void DeleteSubtree(Node* tree_to_delete);
   void ShiftNodes(Node* node_to_replace);
   void ReplaceNodeByNode(Node* replaceable, Node* replacement);
+  void RotateLeft(Node* node);
+  void RotateRight(Node* node);
+  bool RebalanceAfterInsert(Node* node);
+  static SizeType BlackHeight(const Node* node);
+  template <typename Key>
+  void SplitSubtree(Node* node, SizeType height, const Key& key, Node** less,
+                    SizeType* less_height, Node** rest, SizeType* rest_height);
+  Node* JoinSubtrees(Node* left, SizeType left_height, Node* middle,
+                     Node* right, SizeType right_height, SizeType* height);
+  void RebalanceAfterErase(Node* node, Node* parent);
 };
 
-template <typename T>
-class BinarySearchTree<T>::BinarySearchTreeIterator {
+template <typename T, typename Compare, typename Allocator>
+class BinarySearchTree<T, Compare, Allocator>::BinarySearchTreeIterator {
  public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const T*;
+  using reference = const T&;
   BinarySearchTreeIterator() {}
-  BinarySearchTreeIterator(const BinarySearchTree* tree, Node* node)
-      : tree_ {tree}, node_ {node} {}
+  explicit BinarySearchTreeIterator(NodeBase* node) : node_ {node} {}
   BinarySearchTreeIterator(const BinarySearchTreeIterator& other)
-      : tree_ {other.tree_}, node_ {other.node_} {}
+      : node_ {other.node_} {}
   BinarySearchTreeIterator(BinarySearchTreeIterator&& other) {
     *this = std::move(other);
   }
   BinarySearchTreeIterator& operator=(const BinarySearchTreeIterator& other) {
-    tree_ = other.tree_;
     node_ = other.node_;
     return *this;
   }
   BinarySearchTreeIterator& operator=(BinarySearchTreeIterator&& other) {
-    tree_ = nullptr;
     node_ = nullptr;
     std::swap(node_, other.node_);
-    std::swap(tree_, other.tree_);
     return *this;
   }
   ~BinarySearchTreeIterator() {}
   const T& operator*() const {
-    return node_->value;
+    return static_cast<Node*>(node_)->value;
   }
+  const T* operator->() const { return &**this; }
   BinarySearchTreeIterator& operator++() {
-    node_ = tree_->Successor(node_);
+    node_ = NextNode(node_);
     return *this;
   }
   BinarySearchTreeIterator& operator--() {
-    node_ = tree_->Predecessor(node_);
+    node_ = PreviousNode(node_);
     return *this;
   }
   BinarySearchTreeIterator operator++(int) {
@@ -108,131 +325,818 @@ class BinarySearchTree<T>::BinarySearchTreeIterator {
     return node_ != other.node_;
   }
 
-  const BinarySearchTree* tree_{};
-  Node* node_{};
+  NodeBase* node_{};
 };
 
-template <typename T>
-BinarySearchTree<T>::BinarySearchTree(std::initializer_list<T> const& items) {
+template <typename T, typename Compare, typename Allocator>
+BinarySearchTree<T, Compare, Allocator>::BinarySearchTree(
+    std::initializer_list<T> const& items, const Allocator& allocator)
+    : pool_ {NodeAllocator(allocator)} {
   for (auto item : items) {
     Insert(item);
   }
 }
 
-template <typename T>
-BinarySearchTree<T>& BinarySearchTree<T>::operator=(
+template <typename T, typename Compare, typename Allocator>
+BinarySearchTree<T, Compare, Allocator>::BinarySearchTree(
+    const BinarySearchTree& other)
+    : pool_ {NodeTraits::select_on_container_copy_construction(
+          other.pool_.GetAllocator())} {
+  CopyFrom(other);
+}
+
+template <typename T, typename Compare, typename Allocator>
+BinarySearchTree<T, Compare, Allocator>&
+BinarySearchTree<T, Compare, Allocator>::operator=(
     const BinarySearchTree& other) {
-  for (auto item : other) {
-    Insert(item);
+  if (this == &other) {
+    return *this;
+  }
+  if constexpr (NodeTraits::propagate_on_container_copy_assignment::value) {
+    Clear();
+    NodePool<Node, NodeAllocator> pool {other.pool_.GetAllocator()};
+    pool_.Swap(pool);
   }
+  CopyFrom(other);
   return *this;
 }
 
-template <typename T>
-BinarySearchTree<T>& BinarySearchTree<T>::operator=(
-    BinarySearchTree&& other) {
+template <typename T, typename Compare, typename Allocator>
+void BinarySearchTree<T, Compare, Allocator>::CopyFrom(
+    const BinarySearchTree& other) {
   Clear();
-  std::swap(root_, other.root_);
+  compare_ = other.compare_;
+  pool_.Reserve(other.tree_size_);
+  try {
+    CopySubtree(other.root_, &header_, &root_);
+  } catch (...) {
+    Clear();
+    throw;
+  }
+  header_.left_child = MinimumNode(root_);
+  header_.right_child = MaximumNode(root_);
+  tree_size_ = other.tree_size_;
+}
+
+template <typename T, typename Compare, typename Allocator>
+BinarySearchTree<T, Compare, Allocator>&
+BinarySearchTree<T, Compare, Allocator>::operator=(BinarySearchTree&& other) {
+  if (this == &other) {
+    return *this;
+  }
+  if (!NodeTraits::propagate_on_container_move_assignment::value &&
+      !CanAdoptNodes(other)) {
+    MoveValuesFrom(other);
+    return *this;
+  }
+  Clear();
+  SwapRoots(other);
   std::swap(tree_size_, other.tree_size_);
+  pool_.Swap(other.pool_);
+  std::swap(compare_, other.compare_);
   return *this;
 }
 
-template <typename T>
-typename BinarySearchTree<T>::Iterator BinarySearchTree<T>::Insert(
-    const T& value) {
-  Node* node_to_insert {new Node {nullptr, nullptr, nullptr, value}};
+template <typename T, typename Compare, typename Allocator>
+void BinarySearchTree<T, Compare, Allocator>::MoveValuesFrom(
+    BinarySearchTree& other) {  // NOLINT(runtime/references)
+  // for trees whose allocators differ: the values move into nodes of this
+  // pool, already in order, and other is left empty
+  Clear();
+  compare_ = other.compare_;
+  NodeVector nodes(pool_.GetAllocator());
+  nodes.Reserve(other.tree_size_);
+  try {
+    for (Node* node {other.header_.left_child}; node != nullptr;
+         node = other.Successor(node)) {
+      nodes.PushBack(pool_.New(std::uintptr_t {}, nullptr, nullptr,
+                               std::move(node->value)));
+    }
+  } catch (...) {
+    for (auto node : nodes) {
+      pool_.Delete(node);
+    }
+    throw;
+  }
+  LinkSorted(nodes);
+  other.Clear();
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename BinarySearchTree<T, Compare, Allocator>::Iterator
+BinarySearchTree<T, Compare, Allocator>::Insert(const T& value) {
+  Node* node_to_insert {pool_.New(std::uintptr_t {}, nullptr, nullptr, value)};
   InsertNode(node_to_insert);
-  return Iterator(this, node_to_insert);
+  return Iterator(node_to_insert);
 }
 
-template <typename T>
-typename BinarySearchTree<T>::Iterator BinarySearchTree<T>::Find(
-    const T& key) const {
+template <typename T, typename Compare, typename Allocator>
+typename BinarySearchTree<T, Compare, Allocator>::Iterator
+BinarySearchTree<T, Compare, Allocator>::Insert(Iterator hint, const T& value) {
+  return EmplaceHint(hint, value);
+}
+
+template <typename T, typename Compare, typename Allocator>
+template <typename... Args>
+typename BinarySearchTree<T, Compare, Allocator>::Iterator
+BinarySearchTree<T, Compare, Allocator>::EmplaceHint(Iterator hint,
+                                                     Args&&... args) {
+  Node* node {pool_.New(std::uintptr_t {}, nullptr, nullptr,
+                        T(std::forward<Args>(args)...))};
+  return InsertNodeWithHint(hint, node, false);
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename BinarySearchTree<T, Compare, Allocator>::Iterator
+BinarySearchTree<T, Compare, Allocator>::Find(const T& key) const {
+  return MakeIterator(FindNode(key));
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename BinarySearchTree<T, Compare, Allocator>::Iterator
+BinarySearchTree<T, Compare, Allocator>::Select(SizeType index) const {
+  return MakeIterator(SelectNode(&index));
+}
+
+template <typename T, typename Compare, typename Allocator>
+void BinarySearchTree<T, Compare, Allocator>::Erase(Iterator pos) {
+  Node* node {ToNode(pos.node_)};
+  if (node == nullptr) {
+    return;
+  }
+  ShiftNodes(node);
+  pool_.Delete(node);
+  --tree_size_;
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename BinarySearchTree<T, Compare, Allocator>::Iterator
+BinarySearchTree<T, Compare, Allocator>::Erase(Iterator first, Iterator last) {
+  EraseRange(ToNode(first.node_), ToNode(last.node_));
+  return last;
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename BinarySearchTree<T, Compare, Allocator>::SizeType
+BinarySearchTree<T, Compare, Allocator>::Erase(const T& key) {
+  // a key held by one node, as always in a tree of unique values, is
+  // unlinked on its own, only runs of equal values go through EraseRange
+  Node* first {LowerBoundNode(key)};
+  if (first == nullptr || compare_(key, first->value)) {
+    return 0;
+  }
+  Node* next {Successor(first)};
+  if (next == nullptr || compare_(key, next->value)) {
+    Erase(Iterator(first));
+    return 1;
+  }
+  return EraseRange(first, UpperBoundNode(key));
+}
+
+template <typename T, typename Compare, typename Allocator>
+template <typename Predicate>
+typename BinarySearchTree<T, Compare, Allocator>::SizeType
+BinarySearchTree<T, Compare, Allocator>::EraseIf(Predicate pred) {
+  NodeVector doomed(pool_.GetAllocator());
+  NodeVector survivors(pool_.GetAllocator());
+  survivors.Reserve(tree_size_);
+  for (Node* node {header_.left_child}; node != nullptr;
+       node = Successor(node)) {
+    if (pred(node->value)) {
+      doomed.PushBack(node);
+    } else {
+      survivors.PushBack(node);
+    }
+  }
+  if (IsBulkErase(doomed.Size())) {
+    RebuildWithout(doomed, survivors);
+  } else {
+    UnlinkNodes(doomed);
+  }
+  return doomed.Size();
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename BinarySearchTree<T, Compare, Allocator>::SizeType
+BinarySearchTree<T, Compare, Allocator>::EraseRange(Node* first, Node* last) {
+  // last == nullptr stands for the end of the tree
+  NodeVector doomed(pool_.GetAllocator());
+  for (Node* node {first}; node != last; node = Successor(node)) {
+    doomed.PushBack(node);
+  }
+  if (!IsBulkErase(doomed.Size())) {
+    UnlinkNodes(doomed);
+    return doomed.Size();
+  }
+  NodeVector survivors(pool_.GetAllocator());
+  survivors.Reserve(tree_size_ - doomed.Size());
+  for (Node* node {header_.left_child}; node != first;
+       node = Successor(node)) {
+    survivors.PushBack(node);
+  }
+  for (Node* node {last}; node != nullptr; node = Successor(node)) {
+    survivors.PushBack(node);
+  }
+  RebuildWithout(doomed, survivors);
+  return doomed.Size();
+}
+
+template <typename T, typename Compare, typename Allocator>
+void BinarySearchTree<T, Compare, Allocator>::UnlinkNodes(
+    const NodeVector& doomed) {
+  for (auto node : doomed) {
+    ShiftNodes(node);
+    pool_.Delete(node);
+  }
+  tree_size_ -= doomed.Size();
+}
+
+template <typename T, typename Compare, typename Allocator>
+void BinarySearchTree<T, Compare, Allocator>::RebuildWithout(
+    const NodeVector& doomed, const NodeVector& survivors) {
+  for (auto node : doomed) {
+    pool_.Delete(node);
+  }
+  LinkSorted(survivors);
+}
+
+template <typename T, typename Compare, typename Allocator>
+template <typename InputIt>
+void BinarySearchTree<T, Compare, Allocator>::AssignSorted(InputIt first,
+                                                           InputIt last) {
+  AssignRange(first, last, false);
+}
+
+template <typename T, typename Compare, typename Allocator>
+template <typename InputIt>
+void BinarySearchTree<T, Compare, Allocator>::AssignRange(InputIt first,
+                                                          InputIt last,
+                                                          bool unique) {
+  Clear();
+  NodeVector nodes(pool_.GetAllocator());
+  Node* pending_node {};
+  bool sorted {true};
+  try {
+    for (; first != last; ++first) {
+      pending_node = pool_.New(std::uintptr_t {}, nullptr, nullptr, *first);
+      if (!nodes.Empty()) {
+        if (unique && !compare_(pending_node->value, nodes.Back()->value) &&
+            !compare_(nodes.Back()->value, pending_node->value)) {
+          pool_.Delete(pending_node);
+          pending_node = nullptr;
+          continue;
+        }
+        if (compare_(pending_node->value, nodes.Back()->value)) {
+          sorted = false;
+        }
+      }
+      nodes.PushBack(pending_node);
+      pending_node = nullptr;
+    }
+  } catch (...) {
+    pool_.Delete(pending_node);
+    for (auto built_node : nodes) {
+      pool_.Delete(built_node);
+    }
+    Clear();
+    throw;
+  }
+  if (!sorted) {
+    for (auto node : nodes) {
+      InsertPosition position {FindInsertPosition(node->value, unique)};
+      if (position.match != nullptr) {
+        pool_.Delete(node);
+      } else {
+        LinkNode(node, position);
+      }
+    }
+    return;
+  }
+  LinkSorted(nodes);
+}
+
+template <typename T, typename Compare, typename Allocator>
+void BinarySearchTree<T, Compare, Allocator>::LinkSorted(
+    const NodeVector& nodes) {
+  // makes the tree consist of exactly the given nodes in their order
+  root_ = nullptr;
+  header_.left_child = nullptr;
+  header_.right_child = nullptr;
+  tree_size_ = nodes.Size();
+  if (nodes.Empty()) {
+    return;
+  }
+  SizeType red_depth {0};
+  while ((SizeType {2} << red_depth) <= nodes.Size()) {
+    ++red_depth;
+  }
+  root_ = BuildBalanced(&nodes[0], nodes.Size(), &header_, 0, red_depth);
+  root_->SetColor(Color::kBlack);
+  header_.left_child = nodes[0];
+  header_.right_child = nodes.Back();
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename BinarySearchTree<T, Compare, Allocator>::Iterator
+BinarySearchTree<T, Compare, Allocator>::InsertNodeWithHint(Iterator hint,
+                                                            Node* node,
+                                                            bool unique) {
+  // shared by every hinted insert: the hint only replaces the descent,
+  // LinkNode still grows the subtree sizes along the whole path
+  InsertPosition position{};
+  if (!FindHintPosition(ToNode(hint.node_), node->value, unique,
+                        &position)) {
+    position = FindInsertPosition(node->value, unique);
+  }
+  if (position.match != nullptr) {
+    pool_.Delete(node);
+    return Iterator(position.match);
+  }
+  LinkNode(node, position);
+  return Iterator(node);
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename BinarySearchTree<T, Compare, Allocator>::Node*
+BinarySearchTree<T, Compare, Allocator>::SelectNode(SizeType* index) const {
+  // leaves in index the position of the element inside the found node
   Node* node {root_};
-  while (node != nullptr && node->value != key) {
-    if (key < node->value) {
+  while (node != nullptr) {
+    SizeType left_size {SubtreeSize(node->left_child)};
+    if (*index < left_size) {
       node = node->left_child;
+    } else if (*index - left_size < Weight(node)) {
+      *index -= left_size;
+      break;
     } else {
+      *index -= left_size + Weight(node);
       node = node->right_child;
     }
   }
-  return Iterator(this, node);
+  return node;
 }
 
-template <typename T>
-void BinarySearchTree<T>::Erase(Iterator pos) {
-  if (pos.node_ == nullptr) {
-    return;
+template <typename T, typename Compare, typename Allocator>
+void BinarySearchTree<T, Compare, Allocator>::GrowPath(Node* node,
+                                                       SizeType weight) {
+  for (; node != nullptr; node = node->Parent()) {
+    node->subtree_size += weight;
   }
-  ShiftNodes(pos.node_);
-  delete pos.node_;
-  --tree_size_;
 }
 
-template <typename T>
-void BinarySearchTree<T>::MoveNodeFromOtherTree(Iterator other_pos,
-                                                BinarySearchTree& other) {  // NOLINT(runtime/references)
-  if (other_pos.node_ == nullptr) {
+template <typename T, typename Compare, typename Allocator>
+void BinarySearchTree<T, Compare, Allocator>::ShrinkPath(Node* node,
+                                                         SizeType weight) {
+  for (; node != nullptr; node = node->Parent()) {
+    node->subtree_size -= weight;
+  }
+}
+
+template <typename T, typename Compare, typename Allocator>
+void BinarySearchTree<T, Compare, Allocator>::LinkNode(Node* node,
+                                   const InsertPosition& position) {
+  node->left_child = nullptr;
+  node->right_child = nullptr;
+  node->subtree_size = Weight(node);
+  node->SetColor(Color::kRed);
+  if (position.parent == nullptr) {
+    node->SetParent(&header_);
+    root_ = node;
+    header_.left_child = node;
+    header_.right_child = node;
+  } else if (position.left_child) {
+    node->SetParent(position.parent);
+    position.parent->left_child = node;
+    if (position.parent == header_.left_child) {
+      header_.left_child = node;
+    }
+  } else {
+    node->SetParent(position.parent);
+    position.parent->right_child = node;
+    if (position.parent == header_.right_child) {
+      header_.right_child = node;
+    }
+  }
+  GrowPath(position.parent, node->subtree_size);
+  ++tree_size_;
+  RebalanceAfterInsert(node);
+}
+
+template <typename T, typename Compare, typename Allocator>
+template <typename OnEqual>
+void BinarySearchTree<T, Compare, Allocator>::MergeFrom(
+    BinarySearchTree& other, OnEqual on_equal) {  // NOLINT(runtime/references)
+  // nodes of other move over as they are, or as values when too few of
+  // them move to share the chunks (see kAdoptRatio). A node whose value is
+  // already here goes to on_equal(here, node), which returns whether it
+  // absorbed the node, otherwise the node stays in other
+  if (this == &other || other.root_ == nullptr) {
+    return;
+  }
+  if (!CanAdoptNodes(other)) {
+    // the nodes cannot change allocators, so the values of other move to a
+    // tree of this allocator first, and whatever stays there moves back
+    BinarySearchTree moved(GetAllocator());
+    moved.MoveValuesFrom(other);
+    MergeFrom(moved, on_equal);
+    other.MoveValuesFrom(moved);
+    return;
+  }
+  if (root_ == nullptr) {
+    // every node moves, so the pool moves along with them
+    SwapRoots(other);
+    std::swap(tree_size_, other.tree_size_);
+    pool_.Swap(other.pool_);
+    other.pool_.Release();
     return;
   }
-  other.ShiftNodes(other_pos.node_);
-  --other.tree_size_;
-  InsertNode(other_pos.node_);
+  // the pools share their chunks only once enough nodes of other are taken
+  // here, and other lets go of them if it ends up empty
+  SizeType other_size {other.tree_size_};
+  SizeType taken_count {0};
+  bool shared {false};
+  if (other.tree_size_ * kMergeRatio < tree_size_) {
+    for (Node* node {other.header_.left_child}; node != nullptr;) {
+      Node* next {other.Successor(node)};
+      InsertPosition position {FindInsertPosition(node->value, true)};
+      if (position.match == nullptr) {
+        if (!shared && ++taken_count * kAdoptRatio >= other_size) {
+          pool_.Share(other.pool_);
+          shared = true;
+        }
+        Node* taken {shared ? node
+                            : pool_.New(std::uintptr_t {}, nullptr, nullptr,
+                                        std::move_if_noexcept(node->value))};
+        other.ShiftNodes(node);
+        --other.tree_size_;
+        if (taken != node) {
+          other.pool_.Delete(node);
+        }
+        LinkNode(taken, position);
+      } else {
+        SizeType weight {Weight(position.match)};
+        if (on_equal(position.match, node)) {
+          GrowPath(position.match, Weight(position.match) - weight);
+          other.ShiftNodes(node);
+          --other.tree_size_;
+          other.pool_.Delete(node);
+        }
+      }
+      node = next;
+    }
+    if (other.root_ == nullptr) {
+      other.pool_.Release();
+    }
+    return;
+  }
+  NodeVector merged(pool_.GetAllocator());
+  NodeVector kept(other.pool_.GetAllocator());
+  NodeVector absorbed(other.pool_.GetAllocator());
+  NodeVector taken(other.pool_.GetAllocator());
+  merged.Reserve(tree_size_ + other.tree_size_);
+  kept.Reserve(other.tree_size_);
+  absorbed.Reserve(other.tree_size_);
+  taken.Reserve(other.tree_size_);
+  Node* mine {header_.left_child};
+  Node* theirs {other.header_.left_child};
+  while (mine != nullptr && theirs != nullptr) {
+    if (compare_(mine->value, theirs->value)) {
+      merged.PushBack(mine);
+      mine = Successor(mine);
+    } else if (compare_(theirs->value, mine->value)) {
+      merged.PushBack(theirs);
+      taken.PushBack(theirs);
+      theirs = other.Successor(theirs);
+    } else {
+      merged.PushBack(mine);
+      if (on_equal(mine, theirs)) {
+        absorbed.PushBack(theirs);
+      } else {
+        kept.PushBack(theirs);
+      }
+      mine = Successor(mine);
+      theirs = other.Successor(theirs);
+    }
+  }
+  for (; mine != nullptr; mine = Successor(mine)) {
+    merged.PushBack(mine);
+  }
+  for (; theirs != nullptr; theirs = other.Successor(theirs)) {
+    merged.PushBack(theirs);
+    taken.PushBack(theirs);
+  }
+  if (taken.Size() * kAdoptRatio >= other_size) {
+    pool_.Share(other.pool_);
+  } else if (!taken.Empty()) {
+    MoveTakenNodes(taken, &merged);
+    for (auto node : taken) {
+      absorbed.PushBack(node);
+    }
+  }
+  for (auto node : absorbed) {
+    other.pool_.Delete(node);
+  }
+  LinkSorted(merged);
+  other.LinkSorted(kept);
+  if (kept.Empty()) {
+    other.pool_.Release();
+  }
 }
 
-template <typename T>
-void BinarySearchTree<T>::Swap(BinarySearchTree& other) {
+template <typename T, typename Compare, typename Allocator>
+void BinarySearchTree<T, Compare, Allocator>::MoveTakenNodes(
+    const NodeVector& taken, NodeVector* merged) {
+  // replaces in merged the nodes listed in taken, which come in the same
+  // order, by nodes of this pool holding their values. The slots are
+  // reserved first, so only a throwing copy can fail, and that leaves every
+  // taken value in place
+  NodeVector copies(pool_.GetAllocator());
+  copies.Reserve(taken.Size());
+  pool_.Reserve(taken.Size());
+  try {
+    for (auto node : taken) {
+      copies.PushBack(pool_.New(std::uintptr_t {}, nullptr, nullptr,
+                                std::move_if_noexcept(node->value)));
+    }
+  } catch (...) {
+    for (auto node : copies) {
+      pool_.Delete(node);
+    }
+    throw;
+  }
+  SizeType next {0};
+  for (SizeType index {0}; next < taken.Size(); ++index) {
+    if ((*merged)[index] == taken[next]) {
+      (*merged)[index] = copies[next];
+      ++next;
+    }
+  }
+}
+
+template <typename T, typename Compare, typename Allocator>
+void BinarySearchTree<T, Compare, Allocator>::AssignMerged(
+    const BinarySearchTree& lhs, const BinarySearchTree& rhs,
+    SetOperation operation) {
+  // one in-order pass over both trees copies the chosen values, which come
+  // out sorted and are linked into a balanced tree at the end
+  Clear();
+  compare_ = lhs.compare_;
+  bool keep_left {operation != SetOperation::kIntersection};
+  bool keep_right {operation == SetOperation::kUnion ||
+                   operation == SetOperation::kSymmetricDifference};
+  bool keep_equal {operation == SetOperation::kUnion ||
+                   operation == SetOperation::kIntersection};
+  NodeVector nodes(pool_.GetAllocator());
+  nodes.Reserve(lhs.tree_size_ + (keep_right ? rhs.tree_size_ : 0));
+  auto append {[this, &nodes](const T& value) {
+    nodes.PushBack(pool_.New(std::uintptr_t {}, nullptr, nullptr, value));
+  }};
+  try {
+    Node* left {lhs.header_.left_child};
+    Node* right {rhs.header_.left_child};
+    while (left != nullptr && right != nullptr) {
+      if (compare_(left->value, right->value)) {
+        if (keep_left) {
+          append(left->value);
+        }
+        left = lhs.Successor(left);
+      } else if (compare_(right->value, left->value)) {
+        if (keep_right) {
+          append(right->value);
+        }
+        right = rhs.Successor(right);
+      } else {
+        if (keep_equal) {
+          append(left->value);
+        }
+        left = lhs.Successor(left);
+        right = rhs.Successor(right);
+      }
+    }
+    for (; keep_left && left != nullptr; left = lhs.Successor(left)) {
+      append(left->value);
+    }
+    for (; keep_right && right != nullptr; right = rhs.Successor(right)) {
+      append(right->value);
+    }
+  } catch (...) {
+    for (auto node : nodes) {
+      pool_.Delete(node);
+    }
+    throw;
+  }
+  LinkSorted(nodes);
+}
+
+template <typename T, typename Compare, typename Allocator>
+void BinarySearchTree<T, Compare, Allocator>::Swap(BinarySearchTree& other) {
   if (this == &other) {
     return;
   }
-  std::swap(root_, other.root_);
+  SwapRoots(other);
   std::swap(tree_size_, other.tree_size_);
+  pool_.Swap(other.pool_);
+  std::swap(compare_, other.compare_);
 }
 
-template <typename T>
-void BinarySearchTree<T>::Clear() {
-  DeleteSubtree(root_);
+template <typename T, typename Compare, typename Allocator>
+BinarySearchTree<T, Compare, Allocator>
+BinarySearchTree<T, Compare, Allocator>::Split(const T& key) {
+  BinarySearchTree rest(GetAllocator());
+  SplitInto(key, &rest);
+  return rest;
+}
+
+template <typename T, typename Compare, typename Allocator>
+void BinarySearchTree<T, Compare, Allocator>::Join(BinarySearchTree& other) {
+  JoinWith(other, false);
+}
+
+template <typename T, typename Compare, typename Allocator>
+template <typename Key>
+void BinarySearchTree<T, Compare, Allocator>::SplitInto(const Key& key,
+                                             BinarySearchTree* rest) {
+  // moves the elements not less than key to the empty tree rest, which
+  // must have an equal allocator; node counts are taken from the subtree
+  // sizes, so every value must weigh one. The pools share their chunks only
+  // when both trees keep nodes, a tree left empty drops them
+  rest->compare_ = compare_;
+  Node* less {};
+  Node* greater {};
+  SizeType less_height {};
+  SizeType greater_height {};
+  SplitSubtree(root_, BlackHeight(root_), key, &less, &less_height, &greater,
+               &greater_height);
+  root_ = less;
+  if (root_ != nullptr) {
+    root_->SetParent(&header_);
+  }
+  header_.left_child = MinimumNode(root_);
+  header_.right_child = MaximumNode(root_);
+  tree_size_ = SubtreeSize(root_);
+  rest->root_ = greater;
+  if (greater != nullptr) {
+    greater->SetParent(&rest->header_);
+  }
+  rest->header_.left_child = MinimumNode(greater);
+  rest->header_.right_child = MaximumNode(greater);
+  rest->tree_size_ = SubtreeSize(greater);
+  if (less == nullptr) {
+    rest->pool_.Swap(pool_);
+    pool_.Release();
+  } else if (greater != nullptr) {
+    rest->pool_.Share(pool_);
+  }
+}
+
+template <typename T, typename Compare, typename Allocator>
+void BinarySearchTree<T, Compare, Allocator>::JoinWith(BinarySearchTree& other,
+                                            bool unique) {
+  // the trees may come in either order, but their ranges must not overlap
+  if (this == &other || other.root_ == nullptr) {
+    return;
+  }
+  if (!CanAdoptNodes(other)) {
+    BinarySearchTree moved(GetAllocator());
+    moved.MoveValuesFrom(other);
+    try {
+      JoinWith(moved, unique);
+    } catch (...) {
+      other.MoveValuesFrom(moved);
+      throw;
+    }
+    return;
+  }
+  if (root_ == nullptr) {
+    SwapRoots(other);
+    std::swap(tree_size_, other.tree_size_);
+    pool_.Swap(other.pool_);
+    other.pool_.Release();
+    return;
+  }
+  Node* other_first {other.header_.left_child};
+  Node* other_last {other.header_.right_child};
+  bool other_after {unique
+                        ? compare_(header_.right_child->value,
+                                   other_first->value)
+                        : !compare_(other_first->value,
+                                    header_.right_child->value)};
+  bool other_before {!other_after &&
+                     (unique ? compare_(other_last->value,
+                                        header_.left_child->value)
+                             : !compare_(header_.left_child->value,
+                                         other_last->value))};
+  if (!other_after && !other_before) {
+    throw std::invalid_argument("Joined trees overlap");
+  }
+  pool_.Share(other.pool_);
+  Node* first {other_before ? other_first : header_.left_child};
+  Node* last {other_after ? other_last : header_.right_child};
+  // the neighbouring end of other becomes the node that links both trees
+  Node* middle {other_after ? other_first : other_last};
+  other.ShiftNodes(middle);
+  SizeType this_height {BlackHeight(root_)};
+  SizeType other_height {BlackHeight(other.root_)};
+  Node* this_root {root_};
+  SizeType height {};
+  if (other_after) {
+    JoinSubtrees(this_root, this_height, middle, other.root_, other_height,
+                 &height);
+  } else {
+    JoinSubtrees(other.root_, other_height, middle, this_root, this_height,
+                 &height);
+  }
+  header_.left_child = first;
+  header_.right_child = last;
+  tree_size_ += other.tree_size_;
+  other.root_ = nullptr;
+  other.header_.left_child = nullptr;
+  other.header_.right_child = nullptr;
+  other.tree_size_ = 0;
+  other.pool_.Release();
+}
+
+template <typename T, typename Compare, typename Allocator>
+void BinarySearchTree<T, Compare, Allocator>::Clear() {
+  // chunks shared with another tree outlive this one, so its nodes go back
+  // to their free list instead of being dropped with the pool
+  if (!std::is_trivially_destructible<T>::value || pool_.IsShared()) {
+    DeleteSubtree(root_);
+  }
+  pool_.Release();
   root_ = nullptr;
+  header_.left_child = nullptr;
+  header_.right_child = nullptr;
   tree_size_ = 0;
 }
 
-template <typename T>
-typename BinarySearchTree<T>::Node* BinarySearchTree<T>::Successor(
-    Node* node) const {
-  if (node == nullptr) {
-    return MinimumNode(root_);
+template <typename T, typename Compare, typename Allocator>
+void BinarySearchTree<T, Compare, Allocator>::SwapRoots(
+    BinarySearchTree& other) {
+  // the headers stay in place, only the roots are relinked to them
+  std::swap(root_, other.root_);
+  std::swap(header_.left_child, other.header_.left_child);
+  std::swap(header_.right_child, other.header_.right_child);
+  if (root_ != nullptr) {
+    root_->SetParent(&header_);
   }
-  if (node->right_child != nullptr) {
-    return MinimumNode(node->right_child);
+  if (other.root_ != nullptr) {
+    other.root_->SetParent(&other.header_);
   }
-  Node* successor {node->parent};
-  while (successor != nullptr && node == successor->right_child) {
-    node = successor;
-    successor = successor->parent;
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename BinarySearchTree<T, Compare, Allocator>::NodeBase*
+BinarySearchTree<T, Compare, Allocator>::NextNode(NodeBase* node) {
+  // the header follows the last node and precedes the first one
+  if (node->IsHeader()) {
+    return node->left_child != nullptr ? node->left_child : node;
+  }
+  Node* current {static_cast<Node*>(node)};
+  if (current->right_child != nullptr) {
+    return MinimumNode(current->right_child);
   }
-  return successor;
+  NodeBase* parent {current->ParentBase()};
+  while (!parent->IsHeader() && current == parent->right_child) {
+    current = static_cast<Node*>(parent);
+    parent = current->ParentBase();
+  }
+  return parent;
 }
 
-template <typename T>
-typename BinarySearchTree<T>::Node* BinarySearchTree<T>::Predecessor(
-    Node* node) const {
-  if (node == nullptr) {
-    return MaximumNode(root_);
+template <typename T, typename Compare, typename Allocator>
+typename BinarySearchTree<T, Compare, Allocator>::NodeBase*
+BinarySearchTree<T, Compare, Allocator>::PreviousNode(NodeBase* node) {
+  if (node->IsHeader()) {
+    return node->right_child != nullptr ? node->right_child : node;
   }
-  if (node->left_child != nullptr) {
-    return MaximumNode(node->left_child);
+  Node* current {static_cast<Node*>(node)};
+  if (current->left_child != nullptr) {
+    return MaximumNode(current->left_child);
   }
-  Node* predecessor {node->parent};
-  while (predecessor != nullptr && node == predecessor->left_child) {
-    node = predecessor;
-    predecessor = predecessor->parent;
+  NodeBase* parent {current->ParentBase()};
+  while (!parent->IsHeader() && current == parent->left_child) {
+    current = static_cast<Node*>(parent);
+    parent = current->ParentBase();
   }
-  return predecessor;
+  return parent;
 }
 
-template <typename T>
-typename BinarySearchTree<T>::Node* BinarySearchTree<T>::MaximumNode(
-    Node* subtree) const {
+template <typename T, typename Compare, typename Allocator>
+typename BinarySearchTree<T, Compare, Allocator>::Node*
+BinarySearchTree<T, Compare, Allocator>::Successor(Node* node) const {
+  return ToNode(NextNode(node != nullptr ? node : &header_));
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename BinarySearchTree<T, Compare, Allocator>::Node*
+BinarySearchTree<T, Compare, Allocator>::Predecessor(Node* node) const {
+  return ToNode(PreviousNode(node != nullptr ? node : &header_));
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename BinarySearchTree<T, Compare, Allocator>::Node*
+BinarySearchTree<T, Compare, Allocator>::MaximumNode(Node* subtree) {
   if (subtree == nullptr) {
     return nullptr;
   }
@@ -242,9 +1146,9 @@ typename BinarySearchTree<T>::Node* BinarySearchTree<T>::MaximumNode(
   return subtree;
 }
 
-template <typename T>
-typename BinarySearchTree<T>::Node* BinarySearchTree<T>::MinimumNode(
-    Node* subtree) const {
+template <typename T, typename Compare, typename Allocator>
+typename BinarySearchTree<T, Compare, Allocator>::Node*
+BinarySearchTree<T, Compare, Allocator>::MinimumNode(Node* subtree) {
   if (subtree == nullptr) {
     return nullptr;
   }
@@ -254,84 +1158,540 @@ typename BinarySearchTree<T>::Node* BinarySearchTree<T>::MinimumNode(
   return subtree;
 }
 
-template <typename T>
-void BinarySearchTree<T>::InsertNode(Node* node_to_insert) {
+template <typename T, typename Compare, typename Allocator>
+void BinarySearchTree<T, Compare, Allocator>::InsertNode(Node* node_to_insert) {
   if (node_to_insert == nullptr) {
     return;
   }
-  node_to_insert->left_child = nullptr;
-  node_to_insert->right_child = nullptr;
-  Node* current_node {root_};
-  Node* prev_node {nullptr};
-  while (current_node != nullptr) {
-    prev_node = current_node;
-    if (node_to_insert->value < current_node->value) {
-      current_node = current_node->left_child;
+  LinkNode(node_to_insert, FindInsertPosition(node_to_insert->value, false));
+}
+
+template <typename T, typename Compare, typename Allocator>
+void BinarySearchTree<T, Compare, Allocator>::CopySubtree(const Node* source,
+                                               NodeBase* parent, Node** link) {
+  // every node is linked before its children are copied, so Clear() can
+  // reach all of them if a copy constructor throws
+  if (source == nullptr) {
+    return;
+  }
+  Node* node {pool_.New(source->parent_and_color, nullptr, nullptr,
+                        source->value)};
+  node->SetParent(parent);
+  node->subtree_size = source->subtree_size;
+  *link = node;
+  CopySubtree(source->left_child, node, &node->left_child);
+  CopySubtree(source->right_child, node, &node->right_child);
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename BinarySearchTree<T, Compare, Allocator>::Node*
+BinarySearchTree<T, Compare, Allocator>::BuildBalanced(
+    Node* const* nodes, SizeType count, NodeBase* parent, SizeType depth,
+    SizeType red_depth) {
+  // all levels above red_depth are full, so colouring only the deepest level
+  // red gives every path the same black height
+  if (count == 0) {
+    return nullptr;
+  }
+  SizeType middle {count / 2};
+  Node* node {nodes[middle]};
+  node->SetParent(parent);
+  node->SetColor(depth == red_depth ? Color::kRed : Color::kBlack);
+  node->left_child = BuildBalanced(nodes, middle, node, depth + 1, red_depth);
+  node->right_child = BuildBalanced(nodes + middle + 1, count - middle - 1,
+                                    node, depth + 1, red_depth);
+  node->subtree_size = SubtreeSize(node->left_child) +
+                       SubtreeSize(node->right_child) + Weight(node);
+  return node;
+}
+
+template <typename T, typename Compare, typename Allocator>
+template <typename Key>
+typename BinarySearchTree<T, Compare, Allocator>::Node*
+BinarySearchTree<T, Compare, Allocator>::LowerBoundNode(const Key& key) const {
+  Node* node {root_};
+  Node* bound {};
+  while (node != nullptr) {
+    if (compare_(node->value, key)) {
+      node = node->right_child;
     } else {
-      current_node = current_node->right_child;
+      bound = node;
+      node = node->left_child;
+    }
+  }
+  return bound;
+}
+
+template <typename T, typename Compare, typename Allocator>
+template <typename Key>
+typename BinarySearchTree<T, Compare, Allocator>::InsertPosition
+BinarySearchTree<T, Compare, Allocator>::FindInsertPosition(const Key& key,
+                                                 bool unique) const {
+  // unique trees descend towards the lower bound, so an equal element is the
+  // last node where the walk turned left; other trees put the new value
+  // after its equals
+  InsertPosition position{};
+  Node* node {root_};
+  Node* bound {};
+  while (node != nullptr) {
+    position.parent = node;
+    position.left_child = unique ? !compare_(node->value, key)
+                                 : compare_(key, node->value);
+    if (position.left_child) {
+      bound = node;
+      node = node->left_child;
+    } else {
+      node = node->right_child;
     }
   }
-  node_to_insert->parent = prev_node;
-  if (prev_node == nullptr) {
-    root_ = node_to_insert;
-  } else if (node_to_insert->value < prev_node->value) {
-    prev_node->left_child = node_to_insert;
+  if (unique && bound != nullptr && !compare_(key, bound->value)) {
+    position.match = bound;
+  }
+  return position;
+}
+
+template <typename T, typename Compare, typename Allocator>
+template <typename Key>
+typename BinarySearchTree<T, Compare, Allocator>::Node*
+BinarySearchTree<T, Compare, Allocator>::UpperBoundNode(const Key& key) const {
+  Node* node {root_};
+  Node* bound {};
+  while (node != nullptr) {
+    if (compare_(key, node->value)) {
+      bound = node;
+      node = node->left_child;
+    } else {
+      node = node->right_child;
+    }
+  }
+  return bound;
+}
+
+template <typename T, typename Compare, typename Allocator>
+template <typename Key>
+typename BinarySearchTree<T, Compare, Allocator>::Node*
+BinarySearchTree<T, Compare, Allocator>::FindNode(const Key& key) const {
+  // one comparison per level on the way down and a single equality check
+  // against the lower bound at the end
+  Node* bound {LowerBoundNode(key)};
+  if (bound == nullptr || compare_(key, bound->value)) {
+    return nullptr;
+  }
+  return bound;
+}
+
+template <typename T, typename Compare, typename Allocator>
+template <typename Key>
+typename BinarySearchTree<T, Compare, Allocator>::SizeType
+BinarySearchTree<T, Compare, Allocator>::RankOf(const Key& key) const {
+  SizeType rank {0};
+  Node* node {root_};
+  while (node != nullptr) {
+    if (compare_(node->value, key)) {
+      rank += SubtreeSize(node->left_child) + Weight(node);
+      node = node->right_child;
+    } else {
+      node = node->left_child;
+    }
+  }
+  return rank;
+}
+
+template <typename T, typename Compare, typename Allocator>
+template <typename Key>
+typename BinarySearchTree<T, Compare, Allocator>::SizeType
+BinarySearchTree<T, Compare, Allocator>::UpperRankOf(const Key& key) const {
+  SizeType rank {0};
+  Node* node {root_};
+  while (node != nullptr) {
+    if (compare_(key, node->value)) {
+      node = node->left_child;
+    } else {
+      rank += SubtreeSize(node->left_child) + Weight(node);
+      node = node->right_child;
+    }
+  }
+  return rank;
+}
+
+template <typename T, typename Compare, typename Allocator>
+template <typename Key>
+typename BinarySearchTree<T, Compare, Allocator>::SizeType
+BinarySearchTree<T, Compare, Allocator>::CountRangeOf(const Key& low,
+                                           const Key& high) const {
+  SizeType low_rank {RankOf(low)};
+  SizeType high_rank {RankOf(high)};
+  return high_rank > low_rank ? high_rank - low_rank : 0;
+}
+
+template <typename T, typename Compare, typename Allocator>
+template <typename Key>
+bool BinarySearchTree<T, Compare, Allocator>::FindHintPosition(
+    Node* hint, const Key& key, bool unique, InsertPosition* position) const {
+  // the hint is right if key fits between its predecessor and the hint
+  Node* prev {Predecessor(hint)};
+  if (hint != nullptr && compare_(hint->value, key)) {
+    return false;
+  }
+  if (prev != nullptr && compare_(key, prev->value)) {
+    return false;
+  }
+  if (unique && hint != nullptr && !compare_(key, hint->value)) {
+    position->match = hint;
+    return true;
+  }
+  if (unique && prev != nullptr && !compare_(prev->value, key)) {
+    position->match = prev;
+    return true;
+  }
+  if (hint != nullptr && hint->left_child == nullptr) {
+    position->parent = hint;
+    position->left_child = true;
   } else {
-    prev_node->right_child = node_to_insert;
+    position->parent = prev;
+    position->left_child = false;
   }
-  ++tree_size_;
+  return true;
 }
 
-template <typename T>
-void BinarySearchTree<T>::DeleteSubtree(Node* tree_to_delete) {
+template <typename T, typename Compare, typename Allocator>
+void BinarySearchTree<T, Compare, Allocator>::DeleteSubtree(
+    Node* tree_to_delete) {
   if (tree_to_delete == nullptr) {
     return;
   }
   DeleteSubtree(tree_to_delete->left_child);
   DeleteSubtree(tree_to_delete->right_child);
-  delete tree_to_delete;
+  pool_.Delete(tree_to_delete);
 }
 
-template <typename T>
-void BinarySearchTree<T>::ShiftNodes(Node* node_to_replace) {
+template <typename T, typename Compare, typename Allocator>
+void BinarySearchTree<T, Compare, Allocator>::ShiftNodes(
+    Node* node_to_replace) {
   if (node_to_replace == nullptr) {
     return;
   }
+  if (node_to_replace == header_.left_child) {
+    header_.left_child = Successor(node_to_replace);
+  }
+  if (node_to_replace == header_.right_child) {
+    header_.right_child = Predecessor(node_to_replace);
+  }
+  Color removed_color {node_to_replace->GetColor()};
+  Node* replacement {};
+  Node* replacement_parent {};
+  // the node that physically leaves its position is node_to_replace itself
+  // or, with two children, its successor; the path between them loses the
+  // successor, which moves up, and everything from node_to_replace up loses
+  // the erased value
+  Node* spliced {node_to_replace};
+  if (node_to_replace->left_child != nullptr &&
+      node_to_replace->right_child != nullptr) {
+    spliced = MinimumNode(node_to_replace->right_child);
+  }
+  Node* ancestor {spliced->Parent()};
+  for (; ancestor != nullptr && spliced != node_to_replace &&
+         ancestor != node_to_replace;
+       ancestor = ancestor->Parent()) {
+    ancestor->subtree_size -= Weight(spliced);
+  }
+  ShrinkPath(ancestor, Weight(node_to_replace));
   if (node_to_replace->left_child == nullptr) {
-    ReplaceNodeByNode(node_to_replace, node_to_replace->right_child);
+    replacement = node_to_replace->right_child;
+    replacement_parent = node_to_replace->Parent();
+    ReplaceNodeByNode(node_to_replace, replacement);
   } else if (node_to_replace->right_child == nullptr) {
-    ReplaceNodeByNode(node_to_replace, node_to_replace->left_child);
+    replacement = node_to_replace->left_child;
+    replacement_parent = node_to_replace->Parent();
+    ReplaceNodeByNode(node_to_replace, replacement);
   } else {
-    Node* successor {Successor(node_to_replace)};
-    if (successor->parent != node_to_replace) {
+    Node* successor {spliced};
+    removed_color = successor->GetColor();
+    replacement = successor->right_child;
+    if (successor->Parent() == node_to_replace) {
+      replacement_parent = successor;
+    } else {
+      replacement_parent = successor->Parent();
       ReplaceNodeByNode(successor, successor->right_child);
       successor->right_child = node_to_replace->right_child;
-      successor->right_child->parent = successor;
+      successor->right_child->SetParent(successor);
     }
     ReplaceNodeByNode(node_to_replace, successor);
     successor->left_child = node_to_replace->left_child;
-    successor->left_child->parent = successor;
+    successor->left_child->SetParent(successor);
+    successor->SetColor(node_to_replace->GetColor());
+    successor->subtree_size = node_to_replace->subtree_size;
+  }
+  if (removed_color == Color::kBlack) {
+    RebalanceAfterErase(replacement, replacement_parent);
   }
 }
 
-template <typename T>
-void BinarySearchTree<T>::ReplaceNodeByNode(Node* replaceable,
-                                            Node* replacement) {
+template <typename T, typename Compare, typename Allocator>
+void BinarySearchTree<T, Compare, Allocator>::ReplaceNodeByNode(
+    Node* replaceable, Node* replacement) {
   if (replaceable == nullptr) {
     return;
   }
-  if (replaceable->parent == nullptr) {
+  Node* parent {replaceable->Parent()};
+  if (parent == nullptr) {
     root_ = replacement;
-  } else if (replaceable == replaceable->parent->left_child) {
-    replaceable->parent->left_child = replacement;
+  } else if (replaceable == parent->left_child) {
+    parent->left_child = replacement;
   } else {
-    replaceable->parent->right_child = replacement;
+    parent->right_child = replacement;
   }
   if (replacement != nullptr) {
-    replacement->parent = replaceable->parent;
+    replacement->SetParent(replaceable->ParentBase());
+  }
+}
+
+template <typename T, typename Compare, typename Allocator>
+void BinarySearchTree<T, Compare, Allocator>::RotateLeft(Node* node) {
+  Node* pivot {node->right_child};
+  node->right_child = pivot->left_child;
+  if (pivot->left_child != nullptr) {
+    pivot->left_child->SetParent(node);
+  }
+  ReplaceNodeByNode(node, pivot);
+  pivot->left_child = node;
+  node->SetParent(pivot);
+  pivot->subtree_size = node->subtree_size;
+  node->subtree_size = SubtreeSize(node->left_child) +
+                       SubtreeSize(node->right_child) + Weight(node);
+}
+
+template <typename T, typename Compare, typename Allocator>
+void BinarySearchTree<T, Compare, Allocator>::RotateRight(Node* node) {
+  Node* pivot {node->left_child};
+  node->left_child = pivot->right_child;
+  if (pivot->right_child != nullptr) {
+    pivot->right_child->SetParent(node);
+  }
+  ReplaceNodeByNode(node, pivot);
+  pivot->right_child = node;
+  node->SetParent(pivot);
+  pivot->subtree_size = node->subtree_size;
+  node->subtree_size = SubtreeSize(node->left_child) +
+                       SubtreeSize(node->right_child) + Weight(node);
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename BinarySearchTree<T, Compare, Allocator>::SizeType
+BinarySearchTree<T, Compare, Allocator>::BlackHeight(const Node* node) {
+  SizeType height {0};
+  for (; node != nullptr; node = node->left_child) {
+    height += IsRed(node) ? 0 : 1;
+  }
+  return height;
+}
+
+template <typename T, typename Compare, typename Allocator>
+template <typename Key>
+void BinarySearchTree<T, Compare, Allocator>::SplitSubtree(
+    Node* node, SizeType height, const Key& key, Node** less,
+    SizeType* less_height, Node** rest, SizeType* rest_height) {
+  // height is the black height of node; every node on the search path is
+  // joined with the part of its other subtree that falls on its side
+  if (node == nullptr) {
+    *less = nullptr;
+    *rest = nullptr;
+    *less_height = 0;
+    *rest_height = 0;
+    return;
+  }
+  SizeType child_height {IsRed(node) ? height : height - 1};
+  Node* left {node->left_child};
+  Node* right {node->right_child};
+  if (compare_(node->value, key)) {
+    Node* right_less {};
+    SizeType right_less_height {};
+    SplitSubtree(right, child_height, key, &right_less, &right_less_height,
+                 rest, rest_height);
+    *less = JoinSubtrees(left, child_height, node, right_less,
+                         right_less_height, less_height);
+  } else {
+    Node* left_rest {};
+    SizeType left_rest_height {};
+    SplitSubtree(left, child_height, key, less, less_height, &left_rest,
+                 &left_rest_height);
+    *rest = JoinSubtrees(left_rest, left_rest_height, node, right,
+                         child_height, rest_height);
   }
 }
 
+template <typename T, typename Compare, typename Allocator>
+typename BinarySearchTree<T, Compare, Allocator>::Node*
+BinarySearchTree<T, Compare, Allocator>::JoinSubtrees(
+    Node* left, SizeType left_height, Node* middle, Node* right,
+    SizeType right_height, SizeType* height) {
+  // links two detached subtrees through middle, which sits between them in
+  // order. middle hangs off the spine of the taller subtree next to a black
+  // node of the other's black height, and is then rebalanced like a fresh
+  // red insert, with root_ lent as the root of the subtree being joined
+  if (IsRed(left)) {
+    left->SetColor(Color::kBlack);
+    ++left_height;
+  }
+  if (IsRed(right)) {
+    right->SetColor(Color::kBlack);
+    ++right_height;
+  }
+  middle->SetColor(Color::kRed);
+  bool left_taller {left_height >= right_height};
+  Node* node {left_taller ? left : right};
+  Node* parent {};
+  SizeType node_height {left_taller ? left_height : right_height};
+  SizeType target_height {left_taller ? right_height : left_height};
+  while (node_height != target_height || IsRed(node)) {
+    node_height -= IsRed(node) ? 0 : 1;
+    parent = node;
+    node = left_taller ? node->right_child : node->left_child;
+  }
+  Node* lower {left_taller ? right : left};
+  middle->left_child = left_taller ? node : lower;
+  middle->right_child = left_taller ? lower : node;
+  if (middle->left_child != nullptr) {
+    middle->left_child->SetParent(middle);
+  }
+  if (middle->right_child != nullptr) {
+    middle->right_child->SetParent(middle);
+  }
+  middle->subtree_size = SubtreeSize(middle->left_child) +
+                         SubtreeSize(middle->right_child) + Weight(middle);
+  if (parent == nullptr) {
+    root_ = middle;
+    middle->SetParent(&header_);
+  } else {
+    root_ = left_taller ? left : right;
+    root_->SetParent(&header_);
+    middle->SetParent(parent);
+    if (left_taller) {
+      parent->right_child = middle;
+    } else {
+      parent->left_child = middle;
+    }
+    GrowPath(parent, SubtreeSize(lower) + Weight(middle));
+  }
+  *height = std::max(left_height, right_height) +
+            (RebalanceAfterInsert(middle) ? 1 : 0);
+  return root_;
+}
+
+template <typename T, typename Compare, typename Allocator>
+bool BinarySearchTree<T, Compare, Allocator>::RebalanceAfterInsert(Node* node) {
+  // returns whether the black height of the tree grew
+  while (node != root_ && IsRed(node->Parent())) {
+    Node* parent {node->Parent()};
+    Node* grandparent {parent->Parent()};
+    if (parent == grandparent->left_child) {
+      Node* uncle {grandparent->right_child};
+      if (IsRed(uncle)) {
+        parent->SetColor(Color::kBlack);
+        uncle->SetColor(Color::kBlack);
+        grandparent->SetColor(Color::kRed);
+        node = grandparent;
+        continue;
+      }
+      if (node == parent->right_child) {
+        RotateLeft(parent);
+        std::swap(node, parent);
+      }
+      parent->SetColor(Color::kBlack);
+      grandparent->SetColor(Color::kRed);
+      RotateRight(grandparent);
+    } else {
+      Node* uncle {grandparent->left_child};
+      if (IsRed(uncle)) {
+        parent->SetColor(Color::kBlack);
+        uncle->SetColor(Color::kBlack);
+        grandparent->SetColor(Color::kRed);
+        node = grandparent;
+        continue;
+      }
+      if (node == parent->left_child) {
+        RotateRight(parent);
+        std::swap(node, parent);
+      }
+      parent->SetColor(Color::kBlack);
+      grandparent->SetColor(Color::kRed);
+      RotateLeft(grandparent);
+    }
+  }
+  bool grew {IsRed(root_)};
+  root_->SetColor(Color::kBlack);
+  return grew;
+}
+
+template <typename T, typename Compare, typename Allocator>
+void BinarySearchTree<T, Compare, Allocator>::RebalanceAfterErase(Node* node,
+                                                       Node* parent) {
+  // node may be nullptr, so its parent is tracked separately
+  while (node != root_ && !IsRed(node)) {
+    if (node == parent->left_child) {
+      Node* sibling {parent->right_child};
+      if (IsRed(sibling)) {
+        sibling->SetColor(Color::kBlack);
+        parent->SetColor(Color::kRed);
+        RotateLeft(parent);
+        sibling = parent->right_child;
+      }
+      if (!IsRed(sibling->left_child) && !IsRed(sibling->right_child)) {
+        sibling->SetColor(Color::kRed);
+        node = parent;
+        parent = node->Parent();
+        continue;
+      }
+      if (!IsRed(sibling->right_child)) {
+        sibling->left_child->SetColor(Color::kBlack);
+        sibling->SetColor(Color::kRed);
+        RotateRight(sibling);
+        sibling = parent->right_child;
+      }
+      sibling->SetColor(parent->GetColor());
+      parent->SetColor(Color::kBlack);
+      sibling->right_child->SetColor(Color::kBlack);
+      RotateLeft(parent);
+    } else {
+      Node* sibling {parent->left_child};
+      if (IsRed(sibling)) {
+        sibling->SetColor(Color::kBlack);
+        parent->SetColor(Color::kRed);
+        RotateRight(parent);
+        sibling = parent->left_child;
+      }
+      if (!IsRed(sibling->left_child) && !IsRed(sibling->right_child)) {
+        sibling->SetColor(Color::kRed);
+        node = parent;
+        parent = node->Parent();
+        continue;
+      }
+      if (!IsRed(sibling->left_child)) {
+        sibling->right_child->SetColor(Color::kBlack);
+        sibling->SetColor(Color::kRed);
+        RotateLeft(sibling);
+        sibling = parent->left_child;
+      }
+      sibling->SetColor(parent->GetColor());
+      parent->SetColor(Color::kBlack);
+      sibling->left_child->SetColor(Color::kBlack);
+      RotateRight(parent);
+    }
+    node = root_;
+  }
+  if (node != nullptr) {
+    node->SetColor(Color::kBlack);
+  }
+}
+
+namespace pmr {
+
+template <typename T, typename Compare = std::less<T>>
+using BinarySearchTree =
+    s21::BinarySearchTree<T, Compare, std::pmr::polymorphic_allocator<T>>;
+
+}  // namespace pmr
+
 }  // namespace s21
 
 #endif  // SRC_BINARY_SEARCH_TREE_H_
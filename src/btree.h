@@ -0,0 +1,614 @@
+#ifndef SRC_BTREE_H_
+#define SRC_BTREE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <new>
+#include <utility>
+
+namespace s21 {
+
+// B-tree with unique values. Every node keeps up to kMaxValues sorted values
+// in one contiguous block of about kTargetNodeSize bytes, so a lookup touches
+// a few cache lines per level instead of one node per comparison.
+template <typename T, typename Compare>
+class BTree {
+ public:
+  using SizeType = std::size_t;
+  class BTreeIterator;
+  using Iterator = BTreeIterator;
+  using ConstIterator = BTreeIterator;
+  BTree() {}
+  explicit BTree(std::initializer_list<T> const& items);
+  BTree(const BTree& other) { *this = other; }
+  BTree(BTree&& other) { *this = std::move(other); }
+  BTree& operator=(const BTree& other);
+  BTree& operator=(BTree&& other);
+  ~BTree() { Clear(); }
+  Iterator begin() const;
+  Iterator end() const { return Iterator(this, nullptr, 0); }
+  std::pair<Iterator, bool> Insert(const T& value) {
+    return InsertUnique(value);
+  }
+  std::pair<Iterator, bool> Insert(T&& value) {
+    return InsertUnique(std::move(value));
+  }
+  template <typename Key>
+  Iterator Find(const Key& key) const;
+  template <typename Key>
+  bool Contains(const Key& key) const { return Find(key) != end(); }
+  void Erase(Iterator pos);
+  void Merge(BTree& other);  // NOLINT(runtime/references)
+  void Swap(BTree& other);  // NOLINT(runtime/references)
+  void Clear();
+  bool Empty() const { return Size() == 0; }
+  SizeType Size() const { return tree_size_; }
+  SizeType MaxSize() const { return std::numeric_limits<SizeType>::max(); }
+
+  static constexpr SizeType kTargetNodeSize {256};
+  static constexpr SizeType kNodeHeaderSize {2 * sizeof(void*)};
+  static constexpr SizeType kMaxValues {
+      (kTargetNodeSize - kNodeHeaderSize) / sizeof(T) > 3
+          ? (kTargetNodeSize - kNodeHeaderSize) / sizeof(T)
+          : 3};
+  static constexpr SizeType kMinValues {(kMaxValues - 1) / 2};
+
+ protected:
+  struct InternalNode;
+  struct LeafNode {
+    T& Value(SizeType index) { return reinterpret_cast<T*>(storage)[index]; }
+    InternalNode* parent{};
+    std::uint16_t position{};
+    std::uint16_t count{};
+    bool leaf{true};
+    alignas(T) unsigned char storage[kMaxValues * sizeof(T)];
+  };
+  struct InternalNode : LeafNode {
+    LeafNode* children[kMaxValues + 1];
+  };
+  static T& ValueAt(Iterator pos) { return pos.node_->Value(pos.position_); }
+  LeafNode* root_{};
+  SizeType tree_size_{};
+  Compare compare_{};
+
+ private:
+  static InternalNode* AsInternal(LeafNode* node) {
+    return static_cast<InternalNode*>(node);
+  }
+  static void Prefetch(const LeafNode* node);
+  static void SetChild(InternalNode* node, SizeType index, LeafNode* child);
+  static void Relocate(T* destination, T* source);
+  static LeafNode* NewNode(bool leaf);
+  static void DeleteNode(LeafNode* node);
+  template <typename Key>
+  SizeType LowerBoundInNode(LeafNode* node, const Key& key) const;
+  template <typename V>
+  std::pair<Iterator, bool> InsertUnique(V&& value);
+  template <typename V>
+  Iterator InsertValue(LeafNode* node, SizeType pos, V&& value,
+                       LeafNode* child);
+  void ShiftRight(LeafNode* node, SizeType pos);
+  void ShiftLeft(LeafNode* node, SizeType pos);
+  void Rebalance(LeafNode* node);
+  void RotateLeft(InternalNode* parent, SizeType pos);
+  void RotateRight(InternalNode* parent, SizeType pos);
+  void MergeChildren(InternalNode* parent, SizeType pos);
+  LeafNode* CopySubtree(LeafNode* source);
+  void DeleteSubtree(LeafNode* node);
+  LeafNode* LeftmostLeaf() const;
+  LeafNode* RightmostLeaf() const;
+};
+
+template <typename T, typename Compare>
+class BTree<T, Compare>::BTreeIterator {
+ public:
+  BTreeIterator() {}
+  BTreeIterator(const BTree* tree, LeafNode* node, SizeType position)
+      : tree_ {tree}, node_ {node}, position_ {position} {}
+  const T& operator*() const {
+    return node_->Value(position_);
+  }
+  BTreeIterator& operator++();
+  BTreeIterator& operator--();
+  BTreeIterator operator++(int) {
+    BTreeIterator tmp {*this};
+    ++(*this);
+    return tmp;
+  }
+  BTreeIterator operator--(int) {
+    BTreeIterator tmp {*this};
+    --(*this);
+    return tmp;
+  }
+  bool operator==(const BTreeIterator& other) const {
+    return node_ == other.node_ && position_ == other.position_;
+  }
+  bool operator!=(const BTreeIterator& other) const {
+    return !(*this == other);
+  }
+
+  const BTree* tree_{};
+  LeafNode* node_{};
+  SizeType position_{};
+};
+
+template <typename T, typename Compare>
+typename BTree<T, Compare>::BTreeIterator&
+BTree<T, Compare>::BTreeIterator::operator++() {
+  if (node_ == nullptr) {
+    *this = tree_->begin();
+    return *this;
+  }
+  if (!node_->leaf) {
+    node_ = AsInternal(node_)->children[position_ + 1];
+    while (!node_->leaf) {
+      node_ = AsInternal(node_)->children[0];
+    }
+    position_ = 0;
+    return *this;
+  }
+  ++position_;
+  while (position_ == node_->count) {
+    if (node_->parent == nullptr) {
+      node_ = nullptr;
+      position_ = 0;
+      break;
+    }
+    position_ = node_->position;
+    node_ = node_->parent;
+  }
+  return *this;
+}
+
+template <typename T, typename Compare>
+typename BTree<T, Compare>::BTreeIterator&
+BTree<T, Compare>::BTreeIterator::operator--() {
+  if (node_ == nullptr) {
+    node_ = tree_->RightmostLeaf();
+    position_ = node_ == nullptr ? 0 : node_->count - 1;
+    return *this;
+  }
+  if (!node_->leaf) {
+    node_ = AsInternal(node_)->children[position_];
+    while (!node_->leaf) {
+      node_ = AsInternal(node_)->children[node_->count];
+    }
+    position_ = node_->count - 1;
+    return *this;
+  }
+  while (position_ == 0) {
+    if (node_->parent == nullptr) {
+      node_ = nullptr;
+      return *this;
+    }
+    position_ = node_->position;
+    node_ = node_->parent;
+  }
+  --position_;
+  return *this;
+}
+
+template <typename T, typename Compare>
+BTree<T, Compare>::BTree(std::initializer_list<T> const& items) {
+  for (const auto& item : items) {
+    Insert(item);
+  }
+}
+
+template <typename T, typename Compare>
+BTree<T, Compare>& BTree<T, Compare>::operator=(const BTree& other) {
+  if (this == &other) {
+    return *this;
+  }
+  Clear();
+  compare_ = other.compare_;
+  if (other.root_ != nullptr) {
+    root_ = CopySubtree(other.root_);
+  }
+  tree_size_ = other.tree_size_;
+  return *this;
+}
+
+template <typename T, typename Compare>
+BTree<T, Compare>& BTree<T, Compare>::operator=(BTree&& other) {
+  if (this == &other) {
+    return *this;
+  }
+  Clear();
+  Swap(other);
+  return *this;
+}
+
+template <typename T, typename Compare>
+typename BTree<T, Compare>::Iterator BTree<T, Compare>::begin() const {
+  return Iterator(this, LeftmostLeaf(), 0);
+}
+
+template <typename T, typename Compare>
+template <typename V>
+auto BTree<T, Compare>::InsertUnique(V&& value)
+    -> std::pair<typename BTree<T, Compare>::Iterator, bool> {
+  if (root_ == nullptr) {
+    root_ = NewNode(true);
+  }
+  LeafNode* node {root_};
+  SizeType pos {};
+  while (true) {
+    pos = LowerBoundInNode(node, value);
+    if (pos < node->count && !compare_(value, node->Value(pos))) {
+      return {Iterator(this, node, pos), false};
+    }
+    if (node->leaf) {
+      break;
+    }
+    node = AsInternal(node)->children[pos];
+    Prefetch(node);
+  }
+  Iterator inserted {InsertValue(node, pos, std::forward<V>(value), nullptr)};
+  ++tree_size_;
+  return {inserted, true};
+}
+
+template <typename T, typename Compare>
+template <typename Key>
+typename BTree<T, Compare>::Iterator BTree<T, Compare>::Find(
+    const Key& key) const {
+  LeafNode* node {root_};
+  while (node != nullptr) {
+    SizeType pos {LowerBoundInNode(node, key)};
+    if (pos < node->count && !compare_(key, node->Value(pos))) {
+      return Iterator(this, node, pos);
+    }
+    if (node->leaf) {
+      break;
+    }
+    node = AsInternal(node)->children[pos];
+    Prefetch(node);
+  }
+  return end();
+}
+
+template <typename T, typename Compare>
+void BTree<T, Compare>::Erase(Iterator pos) {
+  if (pos.node_ == nullptr) {
+    return;
+  }
+  LeafNode* node {pos.node_};
+  SizeType index {pos.position_};
+  if (!node->leaf) {
+    LeafNode* leaf {AsInternal(node)->children[index]};
+    while (!leaf->leaf) {
+      leaf = AsInternal(leaf)->children[leaf->count];
+    }
+    node->Value(index).~T();
+    Relocate(&node->Value(index), &leaf->Value(leaf->count - 1));
+    node = leaf;
+    index = leaf->count - 1;
+  } else {
+    node->Value(index).~T();
+  }
+  ShiftLeft(node, index + 1);
+  --tree_size_;
+  Rebalance(node);
+}
+
+template <typename T, typename Compare>
+void BTree<T, Compare>::Merge(BTree& other) {  // NOLINT(runtime/references)
+  if (this == &other) {
+    return;
+  }
+  // Insert leaves the value untouched when the key is already present, so
+  // it can still be moved into rest, which then replaces other
+  BTree rest{};
+  for (Iterator pos {other.begin()}; pos != other.end(); ++pos) {
+    if (!Insert(std::move(ValueAt(pos))).second) {
+      rest.Insert(std::move(ValueAt(pos)));
+    }
+  }
+  other.Swap(rest);
+}
+
+template <typename T, typename Compare>
+void BTree<T, Compare>::Swap(BTree& other) {
+  if (this == &other) {
+    return;
+  }
+  std::swap(root_, other.root_);
+  std::swap(tree_size_, other.tree_size_);
+  std::swap(compare_, other.compare_);
+}
+
+template <typename T, typename Compare>
+void BTree<T, Compare>::Clear() {
+  DeleteSubtree(root_);
+  root_ = nullptr;
+  tree_size_ = 0;
+}
+
+template <typename T, typename Compare>
+void BTree<T, Compare>::Prefetch(const LeafNode* node) {
+  // requests all cache lines of the node at once instead of missing on them
+  // one by one during the binary search
+#if defined(__GNUC__)
+  const char* begin {reinterpret_cast<const char*>(node)};
+  for (SizeType offset {0}; offset < sizeof(LeafNode); offset += 64) {
+    __builtin_prefetch(begin + offset);
+  }
+#else
+  (void)node;
+#endif
+}
+
+template <typename T, typename Compare>
+void BTree<T, Compare>::SetChild(InternalNode* node, SizeType index,
+                                 LeafNode* child) {
+  node->children[index] = child;
+  child->parent = node;
+  child->position = static_cast<std::uint16_t>(index);
+}
+
+template <typename T, typename Compare>
+void BTree<T, Compare>::Relocate(T* destination, T* source) {
+  new (destination) T(std::move(*source));
+  source->~T();
+}
+
+template <typename T, typename Compare>
+typename BTree<T, Compare>::LeafNode* BTree<T, Compare>::NewNode(bool leaf) {
+  if (leaf) {
+    return new LeafNode;
+  }
+  InternalNode* node {new InternalNode};
+  node->leaf = false;
+  return node;
+}
+
+template <typename T, typename Compare>
+void BTree<T, Compare>::DeleteNode(LeafNode* node) {
+  if (node->leaf) {
+    delete node;
+  } else {
+    delete AsInternal(node);
+  }
+}
+
+template <typename T, typename Compare>
+template <typename Key>
+typename BTree<T, Compare>::SizeType BTree<T, Compare>::LowerBoundInNode(
+    LeafNode* node, const Key& key) const {
+  // the halving step compiles to a conditional move, so the search has no
+  // data-dependent branches
+  SizeType low {0};
+  SizeType length {node->count};
+  while (length > 1) {
+    SizeType half {length / 2};
+    low = compare_(node->Value(low + half - 1), key) ? low + half : low;
+    length -= half;
+  }
+  if (length == 1 && compare_(node->Value(low), key)) {
+    ++low;
+  }
+  return low;
+}
+
+template <typename T, typename Compare>
+template <typename V>
+typename BTree<T, Compare>::Iterator BTree<T, Compare>::InsertValue(
+    LeafNode* node, SizeType pos, V&& value, LeafNode* child) {
+  // child becomes the right neighbour of value in an internal node
+  if (node->count < kMaxValues) {
+    ShiftRight(node, pos);
+    new (&node->Value(pos)) T(std::forward<V>(value));
+    ++node->count;
+    if (!node->leaf) {
+      SetChild(AsInternal(node), pos + 1, child);
+    }
+    return Iterator(this, node, pos);
+  }
+  const SizeType middle {kMaxValues / 2};
+  LeafNode* sibling {NewNode(node->leaf)};
+  for (SizeType i {middle + 1}; i < kMaxValues; ++i) {
+    Relocate(&sibling->Value(i - middle - 1), &node->Value(i));
+  }
+  if (!node->leaf) {
+    for (SizeType i {middle + 1}; i <= kMaxValues; ++i) {
+      SetChild(AsInternal(sibling), i - middle - 1,
+               AsInternal(node)->children[i]);
+    }
+  }
+  sibling->count = static_cast<std::uint16_t>(kMaxValues - middle - 1);
+  T median(std::move(node->Value(middle)));
+  node->Value(middle).~T();
+  node->count = static_cast<std::uint16_t>(middle);
+  Iterator inserted {};
+  if (pos <= middle) {
+    inserted = InsertValue(node, pos, std::forward<V>(value), child);
+  } else {
+    inserted = InsertValue(sibling, pos - middle - 1, std::forward<V>(value),
+                           child);
+  }
+  if (node->parent == nullptr) {
+    InternalNode* new_root {AsInternal(NewNode(false))};
+    new (&new_root->Value(0)) T(std::move(median));
+    new_root->count = 1;
+    SetChild(new_root, 0, node);
+    SetChild(new_root, 1, sibling);
+    root_ = new_root;
+  } else {
+    InsertValue(node->parent, node->position, std::move(median), sibling);
+  }
+  return inserted;
+}
+
+template <typename T, typename Compare>
+void BTree<T, Compare>::ShiftRight(LeafNode* node, SizeType pos) {
+  for (SizeType i {node->count}; i > pos; --i) {
+    Relocate(&node->Value(i), &node->Value(i - 1));
+  }
+  if (!node->leaf) {
+    InternalNode* internal {AsInternal(node)};
+    for (SizeType i {node->count + SizeType {1}}; i > pos + 1; --i) {
+      SetChild(internal, i, internal->children[i - 1]);
+    }
+  }
+}
+
+template <typename T, typename Compare>
+void BTree<T, Compare>::ShiftLeft(LeafNode* node, SizeType pos) {
+  // the value at pos - 1 must already be destroyed, the child at pos is
+  // dropped
+  for (SizeType i {pos}; i < node->count; ++i) {
+    Relocate(&node->Value(i - 1), &node->Value(i));
+  }
+  if (!node->leaf) {
+    InternalNode* internal {AsInternal(node)};
+    for (SizeType i {pos + 1}; i <= node->count; ++i) {
+      SetChild(internal, i - 1, internal->children[i]);
+    }
+  }
+  --node->count;
+}
+
+template <typename T, typename Compare>
+void BTree<T, Compare>::Rebalance(LeafNode* node) {
+  while (node != root_ && node->count < kMinValues) {
+    InternalNode* parent {node->parent};
+    SizeType pos {node->position};
+    LeafNode* left {pos > 0 ? parent->children[pos - 1] : nullptr};
+    LeafNode* right {pos < parent->count ? parent->children[pos + 1] : nullptr};
+    if (left != nullptr && left->count > kMinValues) {
+      RotateRight(parent, pos - 1);
+      return;
+    }
+    if (right != nullptr && right->count > kMinValues) {
+      RotateLeft(parent, pos);
+      return;
+    }
+    MergeChildren(parent, left != nullptr ? pos - 1 : pos);
+    node = parent;
+  }
+  if (root_ != nullptr && root_->count == 0) {
+    LeafNode* old_root {root_};
+    if (root_->leaf) {
+      root_ = nullptr;
+    } else {
+      root_ = AsInternal(root_)->children[0];
+      root_->parent = nullptr;
+      root_->position = 0;
+    }
+    DeleteNode(old_root);
+  }
+}
+
+template <typename T, typename Compare>
+void BTree<T, Compare>::RotateLeft(InternalNode* parent, SizeType pos) {
+  LeafNode* left {parent->children[pos]};
+  LeafNode* right {parent->children[pos + 1]};
+  Relocate(&left->Value(left->count), &parent->Value(pos));
+  Relocate(&parent->Value(pos), &right->Value(0));
+  ++left->count;
+  if (!left->leaf) {
+    InternalNode* internal {AsInternal(right)};
+    SetChild(AsInternal(left), left->count, internal->children[0]);
+    for (SizeType i {0}; i < right->count; ++i) {
+      SetChild(internal, i, internal->children[i + 1]);
+    }
+  }
+  for (SizeType i {1}; i < right->count; ++i) {
+    Relocate(&right->Value(i - 1), &right->Value(i));
+  }
+  --right->count;
+}
+
+template <typename T, typename Compare>
+void BTree<T, Compare>::RotateRight(InternalNode* parent, SizeType pos) {
+  LeafNode* left {parent->children[pos]};
+  LeafNode* right {parent->children[pos + 1]};
+  ShiftRight(right, 0);
+  Relocate(&right->Value(0), &parent->Value(pos));
+  Relocate(&parent->Value(pos), &left->Value(left->count - 1));
+  ++right->count;
+  if (!right->leaf) {
+    InternalNode* internal {AsInternal(right)};
+    SetChild(internal, 1, internal->children[0]);
+    SetChild(internal, 0, AsInternal(left)->children[left->count]);
+  }
+  --left->count;
+}
+
+template <typename T, typename Compare>
+void BTree<T, Compare>::MergeChildren(InternalNode* parent, SizeType pos) {
+  LeafNode* left {parent->children[pos]};
+  LeafNode* right {parent->children[pos + 1]};
+  Relocate(&left->Value(left->count), &parent->Value(pos));
+  for (SizeType i {0}; i < right->count; ++i) {
+    Relocate(&left->Value(left->count + 1 + i), &right->Value(i));
+  }
+  if (!left->leaf) {
+    for (SizeType i {0}; i <= right->count; ++i) {
+      SetChild(AsInternal(left), left->count + 1 + i,
+               AsInternal(right)->children[i]);
+    }
+  }
+  left->count = static_cast<std::uint16_t>(left->count + 1 + right->count);
+  ShiftLeft(parent, pos + 1);
+  DeleteNode(right);
+}
+
+template <typename T, typename Compare>
+typename BTree<T, Compare>::LeafNode* BTree<T, Compare>::CopySubtree(
+    LeafNode* source) {
+  LeafNode* node {NewNode(source->leaf)};
+  for (SizeType i {0}; i < source->count; ++i) {
+    new (&node->Value(i)) T(source->Value(i));
+    ++node->count;
+  }
+  if (!source->leaf) {
+    for (SizeType i {0}; i <= source->count; ++i) {
+      SetChild(AsInternal(node), i,
+               CopySubtree(AsInternal(source)->children[i]));
+    }
+  }
+  return node;
+}
+
+template <typename T, typename Compare>
+void BTree<T, Compare>::DeleteSubtree(LeafNode* node) {
+  if (node == nullptr) {
+    return;
+  }
+  if (!node->leaf) {
+    for (SizeType i {0}; i <= node->count; ++i) {
+      DeleteSubtree(AsInternal(node)->children[i]);
+    }
+  }
+  for (SizeType i {0}; i < node->count; ++i) {
+    node->Value(i).~T();
+  }
+  DeleteNode(node);
+}
+
+template <typename T, typename Compare>
+typename BTree<T, Compare>::LeafNode* BTree<T, Compare>::LeftmostLeaf() const {
+  LeafNode* node {root_};
+  while (node != nullptr && !node->leaf) {
+    node = AsInternal(node)->children[0];
+  }
+  return node;
+}
+
+template <typename T, typename Compare>
+typename BTree<T, Compare>::LeafNode* BTree<T, Compare>::RightmostLeaf()
+    const {
+  LeafNode* node {root_};
+  while (node != nullptr && !node->leaf) {
+    node = AsInternal(node)->children[node->count];
+  }
+  return node;
+}
+
+}  // namespace s21
+
+#endif  // SRC_BTREE_H_
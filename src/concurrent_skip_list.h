@@ -0,0 +1,434 @@
+#ifndef SRC_CONCURRENT_SKIP_LIST_H_
+#define SRC_CONCURRENT_SKIP_LIST_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <thread>
+#include <utility>
+
+#include "epoch.h"
+
+namespace s21 {
+
+// Ordered set of unique values that any number of threads may insert into,
+// erase from and search at the same time without locks. Each node links to
+// its successor on every level it has. Erase first marks the low bit of the
+// node's links, then the node is unlinked by whichever thread passes over it
+// next, and it goes to the epoch domain once it is off all its levels.
+//
+// Iterators are weakly consistent: they never fail and never see a value
+// twice, and they show every value present during the whole walk, while
+// values inserted or erased during it may or may not show. An iterator that
+// points at a value keeps its thread in the epoch, so it delays reclamation
+// while it lives and must stay on the thread that made it.
+template <typename T, typename Compare>
+class ConcurrentSkipList {
+ protected:
+  struct Node;
+
+ public:
+  using SizeType = std::size_t;
+  class ConcurrentSkipListIterator;
+  using Iterator = ConcurrentSkipListIterator;
+  using ConstIterator = ConcurrentSkipListIterator;
+  ConcurrentSkipList();
+  explicit ConcurrentSkipList(std::initializer_list<T> const& items);
+  ConcurrentSkipList(const ConcurrentSkipList& other) = delete;
+  ConcurrentSkipList& operator=(const ConcurrentSkipList& other) = delete;
+  ~ConcurrentSkipList();
+  Iterator begin() const;
+  Iterator end() const { return Iterator(nullptr); }
+  std::pair<Iterator, bool> Insert(const T& value);
+  template <typename Key>
+  SizeType Erase(const Key& key);
+  template <typename Key>
+  Iterator Find(const Key& key) const;
+  template <typename Key>
+  bool Contains(const Key& key) const;
+  template <typename Key>
+  Iterator LowerBound(const Key& key) const;
+  // exact only while no other thread changes the list
+  SizeType Size() const { return size_.load(); }
+  bool Empty() const { return begin() == end(); }
+  SizeType MaxSize() const { return std::numeric_limits<SizeType>::max(); }
+
+  // with one node in kBranching promoted to the next level, kMaxHeight
+  // levels serve about kBranching ^ kMaxHeight values
+  static constexpr int kMaxHeight {16};
+  static constexpr unsigned kBranching {4};
+
+ protected:
+  using Link = std::atomic<std::uintptr_t>;
+  struct alignas(T) alignas(Link) Node {
+    explicit Node(int node_height)
+        : height {node_height}, link_count {node_height}, storage{} {}
+    T& Value() { return *reinterpret_cast<T*>(storage); }
+    Link& Next(int level) { return reinterpret_cast<Link*>(this + 1)[level]; }
+    int height;
+    // levels the node is linked on or may still be linked on by its insert
+    std::atomic<int> link_count;
+    alignas(T) unsigned char storage[sizeof(T)];
+  };
+  static Node* ToNode(std::uintptr_t link) {
+    return reinterpret_cast<Node*>(link & ~kMarkMask);
+  }
+  static bool IsMarked(std::uintptr_t link) {
+    return (link & kMarkMask) != 0;
+  }
+  static std::uintptr_t ToLink(Node* node) {
+    return reinterpret_cast<std::uintptr_t>(node);
+  }
+  template <typename Key>
+  bool FindPosition(const Key& key, Node** predecessors,
+                    Node** successors) const;
+  Node* head_{};
+  std::atomic<SizeType> size_{};
+  Compare compare_{};
+
+ private:
+  static constexpr std::uintptr_t kMarkMask {1};
+  static Node* NewNode(int height);
+  static void DeleteNode(void* object);
+  static void DestroyNode(void* object);
+  static int RandomHeight();
+  static void ReleaseLink(Node* node, int count);
+  void LinkUpperLevels(Node* node, Node** predecessors, Node** successors);
+};
+
+template <typename T, typename Compare>
+class ConcurrentSkipList<T, Compare>::ConcurrentSkipListIterator {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const T*;
+  using reference = const T&;
+  ConcurrentSkipListIterator() {}
+  explicit ConcurrentSkipListIterator(Node* node) : node_ {node} {
+    if (node_ != nullptr) {
+      EpochDomain::Global().Enter();
+    }
+  }
+  ConcurrentSkipListIterator(const ConcurrentSkipListIterator& other)
+      : ConcurrentSkipListIterator(other.node_) {}
+  ConcurrentSkipListIterator& operator=(
+      const ConcurrentSkipListIterator& other) {
+    ConcurrentSkipListIterator copy {other};
+    std::swap(node_, copy.node_);
+    return *this;
+  }
+  ~ConcurrentSkipListIterator() {
+    if (node_ != nullptr) {
+      EpochDomain::Global().Exit();
+    }
+  }
+  const T& operator*() const { return node_->Value(); }
+  const T* operator->() const { return &node_->Value(); }
+  ConcurrentSkipListIterator& operator++();
+  ConcurrentSkipListIterator operator++(int) {
+    ConcurrentSkipListIterator tmp {*this};
+    ++(*this);
+    return tmp;
+  }
+  bool operator==(const ConcurrentSkipListIterator& other) const {
+    return node_ == other.node_;
+  }
+  bool operator!=(const ConcurrentSkipListIterator& other) const {
+    return !(*this == other);
+  }
+
+ private:
+  Node* node_{};
+};
+
+template <typename T, typename Compare>
+typename ConcurrentSkipList<T, Compare>::ConcurrentSkipListIterator&
+ConcurrentSkipList<T, Compare>::ConcurrentSkipListIterator::operator++() {
+  // the links of an erased node still lead forward, so the walk goes on
+  // from it and only skips the nodes that are being erased
+  std::uintptr_t next {node_->Next(0).load()};
+  node_ = ToNode(next);
+  while (node_ != nullptr && IsMarked(next = node_->Next(0).load())) {
+    node_ = ToNode(next);
+  }
+  if (node_ == nullptr) {
+    EpochDomain::Global().Exit();
+  }
+  return *this;
+}
+
+template <typename T, typename Compare>
+ConcurrentSkipList<T, Compare>::ConcurrentSkipList()
+    : head_ {NewNode(kMaxHeight)} {}
+
+template <typename T, typename Compare>
+ConcurrentSkipList<T, Compare>::ConcurrentSkipList(
+    std::initializer_list<T> const& items)
+    : ConcurrentSkipList() {
+  for (const auto& item : items) {
+    Insert(item);
+  }
+}
+
+template <typename T, typename Compare>
+ConcurrentSkipList<T, Compare>::~ConcurrentSkipList() {
+  // a node is freed on the last level that still links it, so every level
+  // is walked before the nodes it reaches are gone
+  for (int level {0}; level < kMaxHeight; ++level) {
+    Node* node {ToNode(head_->Next(level).load())};
+    while (node != nullptr) {
+      Node* next {ToNode(node->Next(level).load())};
+      if (node->link_count.fetch_sub(1) == 1) {
+        DestroyNode(node);
+      }
+      node = next;
+    }
+  }
+  DeleteNode(head_);
+}
+
+template <typename T, typename Compare>
+typename ConcurrentSkipList<T, Compare>::Iterator
+ConcurrentSkipList<T, Compare>::begin() const {
+  Iterator iter {head_};
+  return ++iter;
+}
+
+template <typename T, typename Compare>
+auto ConcurrentSkipList<T, Compare>::Insert(const T& value)
+    -> std::pair<typename ConcurrentSkipList<T, Compare>::Iterator, bool> {
+  EpochGuard guard{};
+  Node* predecessors[kMaxHeight];
+  Node* successors[kMaxHeight];
+  Node* node {};
+  while (true) {
+    if (FindPosition(value, predecessors, successors)) {
+      if (node != nullptr) {
+        DestroyNode(node);
+      }
+      return {Iterator(successors[0]), false};
+    }
+    if (node == nullptr) {
+      node = NewNode(RandomHeight());
+      try {
+        new (node->storage) T(value);
+      } catch (...) {
+        DeleteNode(node);
+        throw;
+      }
+    }
+    for (int level {0}; level < node->height; ++level) {
+      node->Next(level).store(ToLink(successors[level]));
+    }
+    std::uintptr_t expected {ToLink(successors[0])};
+    if (predecessors[0]->Next(0).compare_exchange_strong(expected,
+                                                         ToLink(node))) {
+      break;
+    }
+  }
+  ++size_;
+  Iterator inserted {node};
+  LinkUpperLevels(node, predecessors, successors);
+  return {inserted, true};
+}
+
+template <typename T, typename Compare>
+template <typename Key>
+typename ConcurrentSkipList<T, Compare>::SizeType
+ConcurrentSkipList<T, Compare>::Erase(const Key& key) {
+  EpochGuard guard{};
+  Node* predecessors[kMaxHeight];
+  Node* successors[kMaxHeight];
+  if (!FindPosition(key, predecessors, successors)) {
+    return 0;
+  }
+  Node* node {successors[0]};
+  for (int level {node->height - 1}; level > 0; --level) {
+    std::uintptr_t next {node->Next(level).load()};
+    while (!IsMarked(next) &&
+           !node->Next(level).compare_exchange_weak(next, next | kMarkMask)) {
+    }
+  }
+  // the thread that marks the bottom level erases the value
+  std::uintptr_t next {node->Next(0).load()};
+  while (!IsMarked(next)) {
+    if (node->Next(0).compare_exchange_weak(next, next | kMarkMask)) {
+      --size_;
+      FindPosition(key, predecessors, successors);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+template <typename T, typename Compare>
+template <typename Key>
+typename ConcurrentSkipList<T, Compare>::Iterator
+ConcurrentSkipList<T, Compare>::Find(const Key& key) const {
+  Iterator iter {LowerBound(key)};
+  if (iter != end() && compare_(key, *iter)) {
+    return end();
+  }
+  return iter;
+}
+
+template <typename T, typename Compare>
+template <typename Key>
+bool ConcurrentSkipList<T, Compare>::Contains(const Key& key) const {
+  // reads without unlinking anything, the marked nodes are stepped over
+  EpochGuard guard{};
+  Node* predecessor {head_};
+  Node* node {};
+  for (int level {kMaxHeight - 1}; level >= 0; --level) {
+    node = ToNode(predecessor->Next(level).load());
+    while (node != nullptr) {
+      std::uintptr_t next {node->Next(level).load()};
+      if (IsMarked(next)) {
+        node = ToNode(next);
+      } else if (compare_(node->Value(), key)) {
+        predecessor = node;
+        node = ToNode(next);
+      } else {
+        break;
+      }
+    }
+  }
+  return node != nullptr && !compare_(key, node->Value());
+}
+
+template <typename T, typename Compare>
+template <typename Key>
+typename ConcurrentSkipList<T, Compare>::Iterator
+ConcurrentSkipList<T, Compare>::LowerBound(const Key& key) const {
+  EpochGuard guard{};
+  Node* predecessors[kMaxHeight];
+  Node* successors[kMaxHeight];
+  FindPosition(key, predecessors, successors);
+  return Iterator(successors[0]);
+}
+
+template <typename T, typename Compare>
+template <typename Key>
+bool ConcurrentSkipList<T, Compare>::FindPosition(const Key& key,
+                                                  Node** predecessors,
+                                                  Node** successors) const {
+  // fills in the last node before key and the first node not before it on
+  // every level, unlinking the marked nodes met on the way, and tells
+  // whether key is present; the caller holds an epoch guard
+  while (true) {
+    bool restart {false};
+    Node* predecessor {head_};
+    for (int level {kMaxHeight - 1}; level >= 0 && !restart; --level) {
+      Node* node {ToNode(predecessor->Next(level).load())};
+      while (node != nullptr) {
+        std::uintptr_t next {node->Next(level).load()};
+        if (IsMarked(next)) {
+          std::uintptr_t expected {ToLink(node)};
+          if (!predecessor->Next(level).compare_exchange_strong(
+                  expected, next & ~kMarkMask)) {
+            restart = true;
+            break;
+          }
+          ReleaseLink(node, 1);
+          node = ToNode(next);
+        } else if (compare_(node->Value(), key)) {
+          predecessor = node;
+          node = ToNode(next);
+        } else {
+          break;
+        }
+      }
+      predecessors[level] = predecessor;
+      successors[level] = node;
+    }
+    if (!restart) {
+      return successors[0] != nullptr &&
+             !compare_(key, successors[0]->Value());
+    }
+  }
+}
+
+template <typename T, typename Compare>
+void ConcurrentSkipList<T, Compare>::LinkUpperLevels(Node* node,
+                                                     Node** predecessors,
+                                                     Node** successors) {
+  // a level that an erase marks before the node is linked on it will never
+  // be linked, and is released here instead of by an unlink
+  for (int level {1}; level < node->height; ++level) {
+    while (true) {
+      std::uintptr_t next {node->Next(level).load()};
+      if (IsMarked(next)) {
+        ReleaseLink(node, node->height - level);
+        return;
+      }
+      std::uintptr_t successor {ToLink(successors[level])};
+      if (next != successor &&
+          !node->Next(level).compare_exchange_strong(next, successor)) {
+        continue;
+      }
+      std::uintptr_t expected {successor};
+      if (predecessors[level]->Next(level).compare_exchange_strong(
+              expected, ToLink(node))) {
+        break;
+      }
+      FindPosition(node->Value(), predecessors, successors);
+    }
+  }
+}
+
+template <typename T, typename Compare>
+typename ConcurrentSkipList<T, Compare>::Node*
+ConcurrentSkipList<T, Compare>::NewNode(int height) {
+  Node* node {new (::operator new(sizeof(Node) + height * sizeof(Link)))
+                   Node(height)};
+  for (int level {0}; level < height; ++level) {
+    new (&node->Next(level)) Link(0);
+  }
+  return node;
+}
+
+template <typename T, typename Compare>
+void ConcurrentSkipList<T, Compare>::DeleteNode(void* object) {
+  // the links and the counter are trivially destructible
+  ::operator delete(object);
+}
+
+template <typename T, typename Compare>
+void ConcurrentSkipList<T, Compare>::DestroyNode(void* object) {
+  static_cast<Node*>(object)->Value().~T();
+  DeleteNode(object);
+}
+
+template <typename T, typename Compare>
+int ConcurrentSkipList<T, Compare>::RandomHeight() {
+  // xorshift, so that every bit is random and not only the high ones
+  thread_local std::uint32_t state {static_cast<std::uint32_t>(
+      std::hash<std::thread::id> {}(std::this_thread::get_id())) | 1u};
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  std::uint32_t bits {state};
+  int height {1};
+  while (height < kMaxHeight && bits % kBranching == 0) {
+    bits /= kBranching;
+    ++height;
+  }
+  return height;
+}
+
+template <typename T, typename Compare>
+void ConcurrentSkipList<T, Compare>::ReleaseLink(Node* node, int count) {
+  if (node->link_count.fetch_sub(count) == count) {
+    EpochDomain::Global().Retire(node, DestroyNode);
+  }
+}
+
+}  // namespace s21
+
+#endif  // SRC_CONCURRENT_SKIP_LIST_H_
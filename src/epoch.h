@@ -0,0 +1,211 @@
+#ifndef SRC_EPOCH_H_
+#define SRC_EPOCH_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Epoch based reclamation for lock-free structures. A thread reads shared
+// nodes only inside an EpochGuard, and a node unlinked from its structure
+// is handed to Retire instead of being deleted. The global epoch advances
+// once every thread inside a guard has seen the current one, and an object
+// retired in epoch e is deleted once the epoch reaches e + 2, when no guard
+// that could still reach it is left. There is one domain per process, so
+// that each thread needs only one record.
+class EpochDomain {
+ public:
+  using Deleter = void (*)(void*);
+  EpochDomain(const EpochDomain& other) = delete;
+  EpochDomain& operator=(const EpochDomain& other) = delete;
+  ~EpochDomain();
+
+  static EpochDomain& Global();
+  void Enter();
+  void Exit();
+  void Retire(void* object, Deleter deleter);
+  void Collect();
+
+  // retirements between two attempts to advance the epoch
+  static constexpr unsigned kAdvancePeriod {64};
+
+ private:
+  EpochDomain() {}
+  struct Retired {
+    void* object;
+    Deleter deleter;
+    std::uint64_t epoch;
+  };
+  // one per thread, reused after the thread exits; records stay in the
+  // list until the domain is destroyed
+  struct ThreadRecord {
+    // (epoch << 1) | 1 inside a guard, 0 outside
+    std::atomic<std::uint64_t> epoch{};
+    std::atomic<bool> in_use{};
+    ThreadRecord* next{};
+    unsigned nesting{};
+    unsigned retired_since_advance{};
+    Vector<Retired> limbo{};
+  };
+  struct RecordHolder {
+    RecordHolder() {}
+    RecordHolder(const RecordHolder& other) = delete;
+    RecordHolder& operator=(const RecordHolder& other) = delete;
+    ~RecordHolder();
+    ThreadRecord* record{};
+  };
+  ThreadRecord* LocalRecord();
+  ThreadRecord* AcquireRecord();
+  bool TryAdvance();
+  static void FreeExpired(Vector<Retired>* retired, std::uint64_t epoch);
+  std::atomic<std::uint64_t> epoch_{};
+  std::atomic<ThreadRecord*> records_{};
+  std::mutex orphans_mutex_{};
+  Vector<Retired> orphans_{};
+};
+
+// Keeps the calling thread inside the current epoch while it lives.
+// Guards nest, and a guard must be destroyed by the thread that made it.
+class EpochGuard {
+ public:
+  EpochGuard() { EpochDomain::Global().Enter(); }
+  EpochGuard(const EpochGuard&) { EpochDomain::Global().Enter(); }
+  EpochGuard& operator=(const EpochGuard&) { return *this; }
+  ~EpochGuard() { EpochDomain::Global().Exit(); }
+};
+
+inline EpochDomain::~EpochDomain() {
+  // no thread may use the domain any more, so everything retired is free
+  ThreadRecord* record {records_.load()};
+  while (record != nullptr) {
+    FreeExpired(&record->limbo, std::numeric_limits<std::uint64_t>::max());
+    ThreadRecord* next {record->next};
+    delete record;
+    record = next;
+  }
+  FreeExpired(&orphans_, std::numeric_limits<std::uint64_t>::max());
+}
+
+inline EpochDomain& EpochDomain::Global() {
+  static EpochDomain domain{};
+  return domain;
+}
+
+inline void EpochDomain::Enter() {
+  ThreadRecord* record {LocalRecord()};
+  if (record->nesting++ == 0) {
+    record->epoch.store((epoch_.load() << 1) | 1);
+  }
+}
+
+inline void EpochDomain::Exit() {
+  ThreadRecord* record {LocalRecord()};
+  if (--record->nesting == 0) {
+    record->epoch.store(0);
+  }
+}
+
+inline void EpochDomain::Retire(void* object, Deleter deleter) {
+  ThreadRecord* record {LocalRecord()};
+  record->limbo.PushBack(Retired {object, deleter, epoch_.load()});
+  if (++record->retired_since_advance >= kAdvancePeriod) {
+    record->retired_since_advance = 0;
+    TryAdvance();
+    Collect();
+  }
+}
+
+inline void EpochDomain::Collect() {
+  // deletes what this thread and exited threads retired two epochs ago
+  std::uint64_t epoch {epoch_.load()};
+  if (epoch < 2) {
+    return;
+  }
+  FreeExpired(&LocalRecord()->limbo, epoch - 2);
+  std::unique_lock<std::mutex> lock {orphans_mutex_, std::try_to_lock};
+  if (lock.owns_lock()) {
+    FreeExpired(&orphans_, epoch - 2);
+  }
+}
+
+inline EpochDomain::ThreadRecord* EpochDomain::LocalRecord() {
+  thread_local RecordHolder holder{};
+  if (holder.record == nullptr) {
+    holder.record = AcquireRecord();
+  }
+  return holder.record;
+}
+
+inline EpochDomain::ThreadRecord* EpochDomain::AcquireRecord() {
+  for (ThreadRecord* record {records_.load()}; record != nullptr;
+       record = record->next) {
+    bool in_use {false};
+    if (record->in_use.compare_exchange_strong(in_use, true)) {
+      return record;
+    }
+  }
+  ThreadRecord* record {new ThreadRecord{}};
+  record->in_use.store(true);
+  record->next = records_.load();
+  while (!records_.compare_exchange_weak(record->next, record)) {
+  }
+  return record;
+}
+
+inline bool EpochDomain::TryAdvance() {
+  std::uint64_t epoch {epoch_.load()};
+  for (ThreadRecord* record {records_.load()}; record != nullptr;
+       record = record->next) {
+    std::uint64_t seen {record->epoch.load()};
+    if ((seen & 1) != 0 && (seen >> 1) != epoch) {
+      return false;
+    }
+  }
+  return epoch_.compare_exchange_strong(epoch, epoch + 1);
+}
+
+inline void EpochDomain::FreeExpired(Vector<Retired>* retired,
+                                     std::uint64_t epoch) {
+  // keeps the entries retired after epoch in their order
+  std::size_t kept {0};
+  for (std::size_t i {0}; i < retired->Size(); ++i) {
+    Retired& entry {(*retired)[i]};
+    if (entry.epoch <= epoch) {
+      entry.deleter(entry.object);
+    } else {
+      (*retired)[kept++] = entry;
+    }
+  }
+  while (retired->Size() > kept) {
+    retired->PopBack();
+  }
+}
+
+inline EpochDomain::RecordHolder::~RecordHolder() {
+  if (record == nullptr) {
+    return;
+  }
+  EpochDomain& domain {Global()};
+  {
+    std::lock_guard<std::mutex> lock {domain.orphans_mutex_};
+    for (std::size_t i {0}; i < record->limbo.Size(); ++i) {
+      domain.orphans_.PushBack(record->limbo[i]);
+    }
+  }
+  record->limbo = Vector<Retired>{};
+  record->nesting = 0;
+  record->retired_since_advance = 0;
+  record->epoch.store(0);
+  record->in_use.store(false);
+  record = nullptr;
+}
+
+}  // namespace s21
+
+#endif  // SRC_EPOCH_H_
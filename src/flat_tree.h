@@ -0,0 +1,531 @@
+#ifndef SRC_FLAT_TREE_H_
+#define SRC_FLAT_TREE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Sorted values in one contiguous Vector. Lookups are binary searches over
+// the array, which touch a few cache lines instead of one node per level,
+// and the container needs no per-element links at all. An insert or erase
+// shifts the values behind its position, so it costs O(n), and it
+// invalidates every iterator at or after that position, or all of them when
+// the Vector grows.
+template <typename T, typename Compare>
+class FlatTree {
+ public:
+  using SizeType = std::size_t;
+  class FlatTreeIterator;
+  using Iterator = FlatTreeIterator;
+  using ConstIterator = FlatTreeIterator;
+  using ReverseIterator = std::reverse_iterator<Iterator>;
+  FlatTree() {}
+  template <typename InputIt>
+  FlatTree(InputIt first, InputIt last) { AssignSorted(first, last); }
+  Iterator begin() const { return Iterator(Values()); }
+  Iterator end() const { return Iterator(Values() + values_.Size()); }
+  ReverseIterator rbegin() const { return ReverseIterator(end()); }
+  ReverseIterator rend() const { return ReverseIterator(begin()); }
+  Iterator Insert(const T& value) { return InsertValue(value, false).first; }
+  Iterator Insert(Iterator hint, const T& value) {
+    return InsertWithHint(hint, value, false);
+  }
+  template <typename... Args>
+  Iterator EmplaceHint(Iterator hint, Args&&... args) {
+    return InsertWithHint(hint, T(std::forward<Args>(args)...), false);
+  }
+  Iterator Find(const T& key) const { return FindOf(key); }
+  template <typename Key, typename C = Compare,
+            typename = typename C::is_transparent>
+  Iterator Find(const Key& key) const { return FindOf(key); }
+  void Erase(Iterator pos);
+  Iterator Erase(Iterator first, Iterator last);
+  SizeType Erase(const T& key);
+  template <typename Predicate>
+  SizeType EraseIf(Predicate pred);
+  void Swap(FlatTree& other);  // NOLINT(runtime/references)
+  FlatTree Split(const T& key);
+  void Join(FlatTree& other) {  // NOLINT(runtime/references)
+    JoinWith(other, false);
+  }
+  void Clear() { values_ = Vector<T>{}; }
+  template <typename InputIt>
+  void AssignSorted(InputIt first, InputIt last) {
+    AssignRange(first, last, false);
+  }
+  void Reserve(SizeType size) { values_.Reserve(size); }
+  void ShrinkToFit() { values_.ShrinkToFit(); }
+  bool Contains(const T& key) const { return FindOf(key) != end(); }
+  template <typename Key, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool Contains(const Key& key) const { return FindOf(key) != end(); }
+  SizeType Rank(const T& key) const { return LowerBoundIndex(key); }
+  template <typename Key, typename C = Compare,
+            typename = typename C::is_transparent>
+  SizeType Rank(const Key& key) const { return LowerBoundIndex(key); }
+  Iterator Select(SizeType index) const {
+    return index < values_.Size() ? Iterator(Values() + index) : end();
+  }
+  SizeType CountRange(const T& low, const T& high) const {
+    return CountRangeOf(low, high);
+  }
+  template <typename Key, typename C = Compare,
+            typename = typename C::is_transparent>
+  SizeType CountRange(const Key& low, const Key& high) const {
+    return CountRangeOf(low, high);
+  }
+  bool Empty() const { return Size() == 0; }
+  SizeType Size() const { return values_.Size(); }
+  SizeType Capacity() const { return values_.Capacity(); }
+  SizeType MaxSize() const { return std::numeric_limits<SizeType>::max(); }
+
+ protected:
+  enum class SetOperation {
+    kUnion,
+    kIntersection,
+    kDifference,
+    kSymmetricDifference
+  };
+  // the vector stays allocated while empty after erases, so an empty tree
+  // is told apart by its size, not by the pointer
+  T* Values() { return values_.Empty() ? nullptr : &values_[0]; }
+  const T* Values() const { return values_.Empty() ? nullptr : &values_[0]; }
+  T& ValueAt(Iterator pos) { return values_[IndexOf(pos)]; }
+  SizeType IndexOf(Iterator pos) const {
+    return static_cast<SizeType>(pos.ptr_ - Values());
+  }
+  template <typename Key>
+  SizeType LowerBoundIndex(const Key& key) const;
+  template <typename Key>
+  SizeType UpperBoundIndex(const Key& key) const;
+  template <typename Key>
+  Iterator FindOf(const Key& key) const;
+  template <typename Key>
+  SizeType CountRangeOf(const Key& low, const Key& high) const;
+  std::pair<Iterator, bool> InsertValue(T value, bool unique);
+  Iterator InsertWithHint(Iterator hint, T value, bool unique);
+  Iterator InsertAt(SizeType index, T value);
+  void EraseIndices(SizeType first, SizeType last);
+  template <typename InputIt>
+  void AssignRange(InputIt first, InputIt last, bool unique);
+  void MergeFrom(FlatTree& other, bool unique);  // NOLINT(runtime/references)
+  void AssignMerged(const FlatTree& lhs, const FlatTree& rhs,
+                    SetOperation operation);
+  template <typename Key>
+  void SplitInto(const Key& key, FlatTree* rest);
+  void JoinWith(FlatTree& other, bool unique);  // NOLINT(runtime/references)
+  Vector<T> values_{};
+  Compare compare_{};
+
+ private:
+  void Truncate(SizeType size);
+};
+
+template <typename T, typename Compare>
+class FlatTree<T, Compare>::FlatTreeIterator {
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const T*;
+  using reference = const T&;
+  FlatTreeIterator() {}
+  explicit FlatTreeIterator(const T* ptr) : ptr_ {ptr} {}
+  const T& operator*() const { return *ptr_; }
+  const T* operator->() const { return ptr_; }
+  const T& operator[](difference_type n) const { return ptr_[n]; }
+  FlatTreeIterator& operator++() {
+    ++ptr_;
+    return *this;
+  }
+  FlatTreeIterator& operator--() {
+    --ptr_;
+    return *this;
+  }
+  FlatTreeIterator operator++(int) {
+    FlatTreeIterator tmp {*this};
+    ++(*this);
+    return tmp;
+  }
+  FlatTreeIterator operator--(int) {
+    FlatTreeIterator tmp {*this};
+    --(*this);
+    return tmp;
+  }
+  FlatTreeIterator& operator+=(difference_type n) {
+    ptr_ += n;
+    return *this;
+  }
+  FlatTreeIterator& operator-=(difference_type n) {
+    ptr_ -= n;
+    return *this;
+  }
+  FlatTreeIterator operator+(difference_type n) const {
+    return FlatTreeIterator(ptr_ + n);
+  }
+  FlatTreeIterator operator-(difference_type n) const {
+    return FlatTreeIterator(ptr_ - n);
+  }
+  difference_type operator-(const FlatTreeIterator& other) const {
+    return ptr_ - other.ptr_;
+  }
+  bool operator==(const FlatTreeIterator& other) const {
+    return ptr_ == other.ptr_;
+  }
+  bool operator!=(const FlatTreeIterator& other) const {
+    return ptr_ != other.ptr_;
+  }
+  bool operator<(const FlatTreeIterator& other) const {
+    return ptr_ < other.ptr_;
+  }
+  bool operator>(const FlatTreeIterator& other) const {
+    return ptr_ > other.ptr_;
+  }
+  bool operator<=(const FlatTreeIterator& other) const {
+    return ptr_ <= other.ptr_;
+  }
+  bool operator>=(const FlatTreeIterator& other) const {
+    return ptr_ >= other.ptr_;
+  }
+
+  const T* ptr_{};
+};
+
+template <typename T, typename Compare>
+void FlatTree<T, Compare>::Erase(Iterator pos) {
+  if (pos == end()) {
+    return;
+  }
+  SizeType index {IndexOf(pos)};
+  EraseIndices(index, index + 1);
+}
+
+template <typename T, typename Compare>
+typename FlatTree<T, Compare>::Iterator FlatTree<T, Compare>::Erase(
+    Iterator first, Iterator last) {
+  // the values after the range move down to first, which is returned
+  SizeType index {IndexOf(first)};
+  EraseIndices(index, IndexOf(last));
+  return Iterator(Values() + index);
+}
+
+template <typename T, typename Compare>
+typename FlatTree<T, Compare>::SizeType FlatTree<T, Compare>::Erase(
+    const T& key) {
+  SizeType first {LowerBoundIndex(key)};
+  SizeType last {UpperBoundIndex(key)};
+  EraseIndices(first, last);
+  return last - first;
+}
+
+template <typename T, typename Compare>
+template <typename Predicate>
+typename FlatTree<T, Compare>::SizeType FlatTree<T, Compare>::EraseIf(
+    Predicate pred) {
+  return values_.EraseIf(pred);
+}
+
+template <typename T, typename Compare>
+void FlatTree<T, Compare>::Swap(FlatTree& other) {
+  if (this == &other) {
+    return;
+  }
+  values_.Swap(other.values_);
+  std::swap(compare_, other.compare_);
+}
+
+template <typename T, typename Compare>
+FlatTree<T, Compare> FlatTree<T, Compare>::Split(const T& key) {
+  FlatTree rest{};
+  SplitInto(key, &rest);
+  return rest;
+}
+
+template <typename T, typename Compare>
+template <typename Key>
+typename FlatTree<T, Compare>::SizeType FlatTree<T, Compare>::LowerBoundIndex(
+    const Key& key) const {
+  // the halving step compiles to a conditional move, so the search has no
+  // data-dependent branches
+  const T* data {Values()};
+  SizeType low {0};
+  SizeType length {values_.Size()};
+  while (length > 1) {
+    SizeType half {length / 2};
+    low = compare_(data[low + half - 1], key) ? low + half : low;
+    length -= half;
+  }
+  if (length == 1 && compare_(data[low], key)) {
+    ++low;
+  }
+  return low;
+}
+
+template <typename T, typename Compare>
+template <typename Key>
+typename FlatTree<T, Compare>::SizeType FlatTree<T, Compare>::UpperBoundIndex(
+    const Key& key) const {
+  const T* data {Values()};
+  SizeType low {0};
+  SizeType length {values_.Size()};
+  while (length > 1) {
+    SizeType half {length / 2};
+    low = !compare_(key, data[low + half - 1]) ? low + half : low;
+    length -= half;
+  }
+  if (length == 1 && !compare_(key, data[low])) {
+    ++low;
+  }
+  return low;
+}
+
+template <typename T, typename Compare>
+template <typename Key>
+typename FlatTree<T, Compare>::Iterator FlatTree<T, Compare>::FindOf(
+    const Key& key) const {
+  SizeType index {LowerBoundIndex(key)};
+  if (index == values_.Size() || compare_(key, values_[index])) {
+    return end();
+  }
+  return Iterator(Values() + index);
+}
+
+template <typename T, typename Compare>
+template <typename Key>
+typename FlatTree<T, Compare>::SizeType FlatTree<T, Compare>::CountRangeOf(
+    const Key& low, const Key& high) const {
+  SizeType low_rank {LowerBoundIndex(low)};
+  SizeType high_rank {LowerBoundIndex(high)};
+  return high_rank > low_rank ? high_rank - low_rank : 0;
+}
+
+template <typename T, typename Compare>
+std::pair<typename FlatTree<T, Compare>::Iterator, bool>
+FlatTree<T, Compare>::InsertValue(T value, bool unique) {
+  // equal values keep their insertion order, a new one goes after them
+  SizeType index {unique ? LowerBoundIndex(value) : UpperBoundIndex(value)};
+  if (unique && index < values_.Size() && !compare_(value, values_[index])) {
+    return {Iterator(Values() + index), false};
+  }
+  return {InsertAt(index, std::move(value)), true};
+}
+
+template <typename T, typename Compare>
+typename FlatTree<T, Compare>::Iterator FlatTree<T, Compare>::InsertWithHint(
+    Iterator hint, T value, bool unique) {
+  // the hint is right if value fits between its predecessor and the hint,
+  // otherwise the position is searched for as without a hint
+  const T* data {Values()};
+  SizeType size {values_.Size()};
+  SizeType index {IndexOf(hint)};
+  if ((index < size && compare_(data[index], value)) ||
+      (index > 0 && compare_(value, data[index - 1]))) {
+    index = unique ? LowerBoundIndex(value) : UpperBoundIndex(value);
+  }
+  if (unique) {
+    if (index < size && !compare_(value, data[index])) {
+      return Iterator(data + index);
+    }
+    if (index > 0 && !compare_(data[index - 1], value)) {
+      return Iterator(data + index - 1);
+    }
+  }
+  return InsertAt(index, std::move(value));
+}
+
+template <typename T, typename Compare>
+typename FlatTree<T, Compare>::Iterator FlatTree<T, Compare>::InsertAt(
+    SizeType index, T value) {
+  values_.Emplace(values_.begin() + index, std::move(value));
+  return Iterator(Values() + index);
+}
+
+template <typename T, typename Compare>
+void FlatTree<T, Compare>::EraseIndices(SizeType first, SizeType last) {
+  values_.Erase(values_.begin() + first, values_.begin() + last);
+}
+
+template <typename T, typename Compare>
+template <typename InputIt>
+void FlatTree<T, Compare>::AssignRange(InputIt first, InputIt last,
+                                       bool unique) {
+  // sorted input is taken as it is, anything else is sorted once; among
+  // equal values of a unique tree the first one stays
+  Vector<T> values{};
+  bool sorted {true};
+  for (; first != last; ++first) {
+    values.PushBack(*first);
+    SizeType size {values.Size()};
+    if (size > 1 && compare_(values[size - 1], values[size - 2])) {
+      sorted = false;
+    }
+  }
+  values_.Swap(values);
+  T* data {Values()};
+  SizeType size {values_.Size()};
+  if (!sorted) {
+    std::stable_sort(data, data + size, compare_);
+  }
+  if (!unique) {
+    return;
+  }
+  SizeType kept {0};
+  for (SizeType i {0}; i < size; ++i) {
+    if (kept > 0 && !compare_(data[kept - 1], data[i])) {
+      continue;
+    }
+    if (kept != i) {
+      data[kept] = std::move(data[i]);
+    }
+    ++kept;
+  }
+  Truncate(kept);
+}
+
+template <typename T, typename Compare>
+void FlatTree<T, Compare>::MergeFrom(FlatTree& other, bool unique) {
+  // one pass over both arrays; in a unique tree the values already present
+  // stay in other, in order
+  if (this == &other || other.Empty()) {
+    return;
+  }
+  T* mine {Values()};
+  T* theirs {other.Values()};
+  SizeType size {values_.Size()};
+  SizeType other_size {other.values_.Size()};
+  Vector<T> merged{};
+  merged.Reserve(size + other_size);
+  Vector<T> kept{};
+  SizeType left {0};
+  SizeType right {0};
+  while (left < size && right < other_size) {
+    if (compare_(theirs[right], mine[left])) {
+      merged.PushBack(std::move(theirs[right++]));
+    } else if (unique && !compare_(mine[left], theirs[right])) {
+      kept.PushBack(std::move(theirs[right++]));
+    } else {
+      merged.PushBack(std::move(mine[left++]));
+    }
+  }
+  for (; left < size; ++left) {
+    merged.PushBack(std::move(mine[left]));
+  }
+  for (; right < other_size; ++right) {
+    merged.PushBack(std::move(theirs[right]));
+  }
+  values_.Swap(merged);
+  other.values_.Swap(kept);
+}
+
+template <typename T, typename Compare>
+void FlatTree<T, Compare>::AssignMerged(const FlatTree& lhs,
+                                        const FlatTree& rhs,
+                                        SetOperation operation) {
+  // one pass over both arrays; equal values pair up one to one, so repeated
+  // values of a multiset come out as many times as std::set_union and the
+  // other std::set_ algorithms would give
+  compare_ = lhs.compare_;
+  bool keep_left {operation != SetOperation::kIntersection};
+  bool keep_right {operation == SetOperation::kUnion ||
+                   operation == SetOperation::kSymmetricDifference};
+  bool keep_equal {operation == SetOperation::kUnion ||
+                   operation == SetOperation::kIntersection};
+  const T* left_values {lhs.Values()};
+  const T* right_values {rhs.Values()};
+  SizeType left_size {lhs.values_.Size()};
+  SizeType right_size {rhs.values_.Size()};
+  Vector<T> values{};
+  values.Reserve(left_size + (keep_right ? right_size : 0));
+  SizeType left {0};
+  SizeType right {0};
+  while (left < left_size && right < right_size) {
+    if (compare_(left_values[left], right_values[right])) {
+      if (keep_left) {
+        values.PushBack(left_values[left]);
+      }
+      ++left;
+    } else if (compare_(right_values[right], left_values[left])) {
+      if (keep_right) {
+        values.PushBack(right_values[right]);
+      }
+      ++right;
+    } else {
+      if (keep_equal) {
+        values.PushBack(left_values[left]);
+      }
+      ++left;
+      ++right;
+    }
+  }
+  for (; keep_left && left < left_size; ++left) {
+    values.PushBack(left_values[left]);
+  }
+  for (; keep_right && right < right_size; ++right) {
+    values.PushBack(right_values[right]);
+  }
+  values_.Swap(values);
+}
+
+template <typename T, typename Compare>
+template <typename Key>
+void FlatTree<T, Compare>::SplitInto(const Key& key, FlatTree* rest) {
+  // moves the values not less than key to the empty tree rest
+  rest->compare_ = compare_;
+  T* data {Values()};
+  SizeType size {values_.Size()};
+  SizeType index {LowerBoundIndex(key)};
+  rest->Reserve(size - index);
+  for (SizeType i {index}; i < size; ++i) {
+    rest->values_.PushBack(std::move(data[i]));
+  }
+  Truncate(index);
+}
+
+template <typename T, typename Compare>
+void FlatTree<T, Compare>::JoinWith(FlatTree& other, bool unique) {
+  // the trees may come in either order, but their ranges must not overlap
+  if (this == &other || other.Empty()) {
+    return;
+  }
+  if (Empty()) {
+    values_.Swap(other.values_);
+    return;
+  }
+  const T& first {values_[0]};
+  const T& last {values_[values_.Size() - 1]};
+  const T& other_first {other.values_[0]};
+  const T& other_last {other.values_[other.values_.Size() - 1]};
+  bool other_after {unique ? compare_(last, other_first)
+                           : !compare_(other_first, last)};
+  bool other_before {!other_after && (unique ? compare_(other_last, first)
+                                             : !compare_(first, other_last))};
+  if (!other_after && !other_before) {
+    throw std::invalid_argument("Joined trees overlap");
+  }
+  if (other_before) {
+    values_.Swap(other.values_);
+  }
+  T* data {other.Values()};
+  SizeType other_size {other.values_.Size()};
+  Reserve(values_.Size() + other_size);
+  for (SizeType i {0}; i < other_size; ++i) {
+    values_.PushBack(std::move(data[i]));
+  }
+  other.Clear();
+}
+
+template <typename T, typename Compare>
+void FlatTree<T, Compare>::Truncate(SizeType size) {
+  values_.Erase(values_.begin() + size, values_.end());
+}
+
+}  // namespace s21
+
+#endif  // SRC_FLAT_TREE_H_
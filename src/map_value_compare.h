@@ -0,0 +1,32 @@
+#ifndef SRC_MAP_VALUE_COMPARE_H_
+#define SRC_MAP_VALUE_COMPARE_H_
+
+#include <utility>
+
+namespace s21 {
+
+// Orders map entries by key with the user supplied key comparator, and
+// compares entries directly against keys, or against any other type the
+// comparator accepts, for lookups. Maps whose entries move, as FlatMap,
+// store them with an assignable key and pass std::pair<Key, T> as Value.
+template <typename Key, typename T, typename Compare,
+          typename Value = std::pair<const Key, T>>
+struct MapValueCompare {
+  using ValueType = Value;
+  bool operator()(const ValueType& lhs, const ValueType& rhs) const {
+    return key_compare(lhs.first, rhs.first);
+  }
+  template <typename K>
+  bool operator()(const ValueType& lhs, const K& rhs) const {
+    return key_compare(lhs.first, rhs);
+  }
+  template <typename K>
+  bool operator()(const K& lhs, const ValueType& rhs) const {
+    return key_compare(lhs, rhs.first);
+  }
+  Compare key_compare{};
+};
+
+}  // namespace s21
+
+#endif  // SRC_MAP_VALUE_COMPARE_H_
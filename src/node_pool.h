@@ -0,0 +1,291 @@
+#ifndef SRC_NODE_POOL_H_
+#define SRC_NODE_POOL_H_
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "allocator_holder.h"
+
+namespace s21 {
+
+// Hands out objects of type T carved from large contiguous chunks. Deleted
+// objects go to a free list and are reused, all chunks are freed at once by
+// Release(), which does not call destructors of live objects. Pools joined by
+// Share() own their chunks and their free list together: an object from one
+// of them may be deleted through the other, a slot deleted through one is
+// reused by either, and the chunks are freed once every sharing pool has
+// been released. Releasing a pool that still shares its chunks keeps the
+// slots it never handed out for the others, but objects it leaves undeleted
+// stay lost until the chunks go, so IsShared() tells an owner to delete them
+// first. Chunks come from the allocator and every arena keeps a copy of it
+// to free them, so only pools with equal allocators may share. Swap()
+// exchanges the allocators too, unless they cannot be assigned, as the
+// polymorphic ones.
+template <typename T, typename Allocator = std::allocator<T>>
+class NodePool : private AllocatorHolder<Allocator> {
+  using AllocatorBase = AllocatorHolder<Allocator>;
+  using AllocatorBase::StoredAllocator;
+
+ public:
+  using SizeType = std::size_t;
+  NodePool() {}
+  explicit NodePool(const Allocator& allocator) : AllocatorBase(allocator) {}
+  NodePool(const NodePool& other) = delete;
+  NodePool(NodePool&& other) : AllocatorBase(other.StoredAllocator()) {
+    Swap(other);
+  }
+  NodePool& operator=(const NodePool& other) = delete;
+  NodePool& operator=(NodePool&& other);
+  ~NodePool() { Release(); }
+
+  template <typename... Args>
+  T* New(Args&&... args);
+  void Delete(T* object);
+  void Reserve(SizeType count);
+  void Release();
+  void Swap(NodePool& other);  // NOLINT(runtime/references)
+  void Share(NodePool& other);  // NOLINT(runtime/references)
+  bool IsShared();
+  Allocator GetAllocator() const { return StoredAllocator(); }
+
+  static constexpr SizeType kMinChunkSize {32};
+  static constexpr SizeType kMaxChunkSize {SizeType {1} << 16};
+
+ private:
+  union Slot {
+    Slot* next;
+    alignas(T) unsigned char storage[sizeof(T)];
+  };
+  using SlotAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Slot>;
+  using SlotTraits = std::allocator_traits<SlotAllocator>;
+  // starts every chunk, in as many slots as it takes
+  struct ChunkHeader {
+    Slot* previous{};
+    SizeType size{};
+  };
+  static constexpr SizeType kHeaderSlots {
+      (sizeof(ChunkHeader) + sizeof(Slot) - 1) / sizeof(Slot)};
+  static ChunkHeader* HeaderOf(Slot* chunk) {
+    return reinterpret_cast<ChunkHeader*>(chunk);
+  }
+  // Owns the chunks and the free slots of every pool that shares it. An
+  // arena merged into another one keeps the surviving arena alive, so the
+  // links form a forest. The free list remembers its last slot, so that two
+  // of them are joined in constant time.
+  struct Arena {
+    explicit Arena(const SlotAllocator& slot_allocator)
+        : allocator {slot_allocator} {}
+    Arena(const Arena& other) = delete;
+    Arena& operator=(const Arena& other) = delete;
+    ~Arena();
+    SlotAllocator allocator;
+    Slot* chunks{};
+    Slot* first_chunk{};
+    Slot* free_list{};
+    Slot* free_tail{};
+    std::shared_ptr<Arena> merged_into{};
+  };
+  std::shared_ptr<Arena> MakeArena() const;
+  Slot* Allocate();
+  void AllocateChunk(SizeType size);
+  Arena* RootArena();
+  static void Free(Arena* arena, Slot* slot);
+  std::shared_ptr<Arena> arena_{};
+  Slot* chunk_cursor_{};
+  Slot* chunk_end_{};
+  SizeType next_chunk_size_{kMinChunkSize};
+};
+
+template <typename T, typename Allocator>
+NodePool<T, Allocator>& NodePool<T, Allocator>::operator=(NodePool&& other) {
+  if (this == &other) {
+    return *this;
+  }
+  Release();
+  Swap(other);
+  return *this;
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+T* NodePool<T, Allocator>::New(Args&&... args) {
+  Slot* slot {Allocate()};
+  try {
+    return new (slot->storage) T {std::forward<Args>(args)...};
+  } catch (...) {
+    Free(RootArena(), slot);
+    throw;
+  }
+}
+
+template <typename T, typename Allocator>
+void NodePool<T, Allocator>::Delete(T* object) {
+  if (object == nullptr) {
+    return;
+  }
+  object->~T();
+  Free(RootArena(), reinterpret_cast<Slot*>(object));
+}
+
+template <typename T, typename Allocator>
+void NodePool<T, Allocator>::Reserve(SizeType count) {
+  if (static_cast<SizeType>(chunk_end_ - chunk_cursor_) >= count) {
+    return;
+  }
+  while (chunk_cursor_ != chunk_end_) {
+    Free(RootArena(), chunk_cursor_++);
+  }
+  AllocateChunk(count);
+}
+
+template <typename T, typename Allocator>
+void NodePool<T, Allocator>::Release() {
+  // the rest of the current chunk goes to the pools that keep the arena
+  if (chunk_cursor_ != chunk_end_ && IsShared()) {
+    Arena* arena {RootArena()};
+    while (chunk_cursor_ != chunk_end_) {
+      Free(arena, chunk_cursor_++);
+    }
+  }
+  arena_.reset();
+  chunk_cursor_ = nullptr;
+  chunk_end_ = nullptr;
+}
+
+template <typename T, typename Allocator>
+void NodePool<T, Allocator>::Swap(NodePool& other) {
+  std::swap(arena_, other.arena_);
+  std::swap(chunk_cursor_, other.chunk_cursor_);
+  std::swap(chunk_end_, other.chunk_end_);
+  std::swap(next_chunk_size_, other.next_chunk_size_);
+  if constexpr (std::is_move_assignable_v<Allocator>) {
+    std::swap(StoredAllocator(), other.StoredAllocator());
+  }
+}
+
+template <typename T, typename Allocator>
+void NodePool<T, Allocator>::Share(NodePool& other) {
+  if (arena_ == nullptr) {
+    arena_ = MakeArena();
+  }
+  Arena* arena {RootArena()};
+  if (other.arena_ == nullptr) {
+    other.arena_ = arena_;
+    return;
+  }
+  Arena* other_arena {other.RootArena()};
+  if (other_arena == arena) {
+    return;
+  }
+  if (other_arena->chunks != nullptr) {
+    HeaderOf(other_arena->first_chunk)->previous = arena->chunks;
+    if (arena->first_chunk == nullptr) {
+      arena->first_chunk = other_arena->first_chunk;
+    }
+    arena->chunks = other_arena->chunks;
+    other_arena->chunks = nullptr;
+    other_arena->first_chunk = nullptr;
+  }
+  if (other_arena->free_list != nullptr) {
+    other_arena->free_tail->next = arena->free_list;
+    if (arena->free_list == nullptr) {
+      arena->free_tail = other_arena->free_tail;
+    }
+    arena->free_list = other_arena->free_list;
+    other_arena->free_list = nullptr;
+    other_arena->free_tail = nullptr;
+  }
+  other_arena->merged_into = arena_;
+  other.arena_ = arena_;
+}
+
+template <typename T, typename Allocator>
+bool NodePool<T, Allocator>::IsShared() {
+  // after RootArena() this pool holds the root directly, so any other owner
+  // is another pool or an arena merged into it
+  if (arena_ == nullptr) {
+    return false;
+  }
+  RootArena();
+  return arena_.use_count() > 1;
+}
+
+template <typename T, typename Allocator>
+typename NodePool<T, Allocator>::Slot* NodePool<T, Allocator>::Allocate() {
+  if (arena_ != nullptr) {
+    Arena* arena {RootArena()};
+    if (arena->free_list != nullptr) {
+      Slot* slot {arena->free_list};
+      arena->free_list = slot->next;
+      return slot;
+    }
+  }
+  if (chunk_cursor_ == chunk_end_) {
+    AllocateChunk(next_chunk_size_);
+    if (next_chunk_size_ < kMaxChunkSize) {
+      next_chunk_size_ *= 2;
+    }
+  }
+  return chunk_cursor_++;
+}
+
+template <typename T, typename Allocator>
+void NodePool<T, Allocator>::AllocateChunk(SizeType size) {
+  if (arena_ == nullptr) {
+    arena_ = MakeArena();
+  }
+  Arena* arena {RootArena()};
+  SizeType length {size + kHeaderSlots};
+  Slot* chunk {SlotTraits::allocate(arena->allocator, length)};
+  ::new (static_cast<void*>(chunk)) ChunkHeader {arena->chunks, length};
+  arena->chunks = chunk;
+  if (arena->first_chunk == nullptr) {
+    arena->first_chunk = chunk;
+  }
+  chunk_cursor_ = chunk + kHeaderSlots;
+  chunk_end_ = chunk + length;
+}
+
+template <typename T, typename Allocator>
+std::shared_ptr<typename NodePool<T, Allocator>::Arena>
+NodePool<T, Allocator>::MakeArena() const {
+  // the arena and its reference count live in the allocator's memory too
+  using ArenaAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Arena>;
+  return std::allocate_shared<Arena>(ArenaAllocator(StoredAllocator()),
+                                     SlotAllocator(StoredAllocator()));
+}
+
+template <typename T, typename Allocator>
+typename NodePool<T, Allocator>::Arena* NodePool<T, Allocator>::RootArena() {
+  while (arena_->merged_into != nullptr) {
+    arena_ = arena_->merged_into;
+  }
+  return arena_.get();
+}
+
+template <typename T, typename Allocator>
+void NodePool<T, Allocator>::Free(Arena* arena, Slot* slot) {
+  if (arena->free_list == nullptr) {
+    arena->free_tail = slot;
+  }
+  slot->next = arena->free_list;
+  arena->free_list = slot;
+}
+
+template <typename T, typename Allocator>
+NodePool<T, Allocator>::Arena::~Arena() {
+  while (chunks != nullptr) {
+    ChunkHeader header {*HeaderOf(chunks)};
+    SlotTraits::deallocate(allocator, chunks, header.size);
+    chunks = header.previous;
+  }
+}
+
+}  // namespace s21
+
+#endif  // SRC_NODE_POOL_H_
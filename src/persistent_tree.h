@@ -0,0 +1,426 @@
+#ifndef SRC_PERSISTENT_TREE_H_
+#define SRC_PERSISTENT_TREE_H_
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <utility>
+
+namespace s21 {
+
+// Weight-balanced search tree with unique values whose nodes never change
+// once built. Versions share nodes through reference counts: copying a tree
+// is O(1) and gives an independent snapshot, and an update copies only the
+// O(log n) nodes on its search path. Any number of threads may read one
+// version while another thread builds the next; handing a new version over
+// to readers needs the synchronisation any shared handle does, such as a
+// mutex or std::atomic_store on a std::shared_ptr to it.
+template <typename T, typename Compare>
+class PersistentTree {
+ protected:
+  struct Node;
+  using NodePtr = std::shared_ptr<const Node>;
+
+ public:
+  using SizeType = std::size_t;
+  class PersistentTreeIterator;
+  using Iterator = PersistentTreeIterator;
+  using ConstIterator = PersistentTreeIterator;
+  PersistentTree() {}
+  explicit PersistentTree(std::initializer_list<T> const& items);
+  Iterator begin() const;
+  Iterator end() const { return Iterator(this, nullptr); }
+  std::pair<Iterator, bool> Insert(const T& value);
+  template <typename Key>
+  SizeType Erase(const Key& key);
+  template <typename Key>
+  Iterator Find(const Key& key) const;
+  template <typename Key>
+  bool Contains(const Key& key) const { return Find(key) != end(); }
+  template <typename Key>
+  SizeType Rank(const Key& key) const;
+  void Swap(PersistentTree& other);  // NOLINT(runtime/references)
+  void Clear() { root_.reset(); }
+  bool Empty() const { return root_ == nullptr; }
+  SizeType Size() const { return SizeOf(root_); }
+  SizeType MaxSize() const { return std::numeric_limits<SizeType>::max(); }
+
+  // a subtree may weigh at most kDelta times its sibling, a rotation is
+  // single when the inner grandchild weighs less than kGamma times the outer
+  static constexpr SizeType kDelta {3};
+  static constexpr SizeType kGamma {2};
+
+ protected:
+  struct Node {
+    template <typename V>
+    Node(V&& node_value, NodePtr left, NodePtr right)
+        : value {std::forward<V>(node_value)},
+          left_child {std::move(left)},
+          right_child {std::move(right)},
+          subtree_size {SizeOf(left_child) + SizeOf(right_child) + 1} {}
+    T value;
+    NodePtr left_child;
+    NodePtr right_child;
+    SizeType subtree_size;
+  };
+  static SizeType SizeOf(const NodePtr& node) {
+    return node == nullptr ? 0 : node->subtree_size;
+  }
+  template <typename V>
+  static NodePtr MakeNode(V&& value, NodePtr left, NodePtr right) {
+    return std::make_shared<const Node>(std::forward<V>(value),
+                                        std::move(left), std::move(right));
+  }
+  template <typename V>
+  std::pair<Iterator, bool> InsertValue(V&& value, bool assign);
+  NodePtr root_{};
+  Compare compare_{};
+
+ private:
+  template <typename V>
+  NodePtr InsertInto(const NodePtr& node, V&& value, bool assign,
+                     bool* inserted) const;
+  template <typename Key>
+  NodePtr EraseFrom(const NodePtr& node, const Key& key, bool* erased) const;
+  static NodePtr EraseMinimum(const NodePtr& node, const Node** minimum);
+  static NodePtr Balance(const T& value, NodePtr left, NodePtr right);
+  static bool IsHeavier(const NodePtr& lhs, const NodePtr& rhs);
+  static NodePtr RotateLeft(const T& value, NodePtr left, const Node& right);
+  static NodePtr RotateRight(const T& value, const Node& left, NodePtr right);
+  static const Node* MinimumNode(const Node* node);
+  static const Node* MaximumNode(const Node* node);
+};
+
+// Nodes have no parent links, since one node may sit in many versions, so
+// the iterator steps by searching from the root of its tree in O(log n).
+// Like any container iterator it is invalidated by a change of its tree.
+template <typename T, typename Compare>
+class PersistentTree<T, Compare>::PersistentTreeIterator {
+ public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const T*;
+  using reference = const T&;
+  PersistentTreeIterator() {}
+  PersistentTreeIterator(const PersistentTree* tree, const Node* node)
+      : tree_ {tree}, node_ {node} {}
+  const T& operator*() const { return node_->value; }
+  const T* operator->() const { return &node_->value; }
+  PersistentTreeIterator& operator++();
+  PersistentTreeIterator& operator--();
+  PersistentTreeIterator operator++(int) {
+    PersistentTreeIterator tmp {*this};
+    ++(*this);
+    return tmp;
+  }
+  PersistentTreeIterator operator--(int) {
+    PersistentTreeIterator tmp {*this};
+    --(*this);
+    return tmp;
+  }
+  bool operator==(const PersistentTreeIterator& other) const {
+    return node_ == other.node_;
+  }
+  bool operator!=(const PersistentTreeIterator& other) const {
+    return !(*this == other);
+  }
+
+ private:
+  const PersistentTree* tree_{};
+  const Node* node_{};
+};
+
+template <typename T, typename Compare>
+typename PersistentTree<T, Compare>::PersistentTreeIterator&
+PersistentTree<T, Compare>::PersistentTreeIterator::operator++() {
+  if (node_ == nullptr) {
+    node_ = MinimumNode(tree_->root_.get());
+    return *this;
+  }
+  if (node_->right_child != nullptr) {
+    node_ = MinimumNode(node_->right_child.get());
+    return *this;
+  }
+  // the successor is the last node the search for this one turned left at
+  const Node* successor {};
+  const Node* current {tree_->root_.get()};
+  while (current != node_) {
+    if (tree_->compare_(node_->value, current->value)) {
+      successor = current;
+      current = current->left_child.get();
+    } else {
+      current = current->right_child.get();
+    }
+  }
+  node_ = successor;
+  return *this;
+}
+
+template <typename T, typename Compare>
+typename PersistentTree<T, Compare>::PersistentTreeIterator&
+PersistentTree<T, Compare>::PersistentTreeIterator::operator--() {
+  if (node_ == nullptr) {
+    node_ = MaximumNode(tree_->root_.get());
+    return *this;
+  }
+  if (node_->left_child != nullptr) {
+    node_ = MaximumNode(node_->left_child.get());
+    return *this;
+  }
+  const Node* predecessor {};
+  const Node* current {tree_->root_.get()};
+  while (current != node_) {
+    if (tree_->compare_(node_->value, current->value)) {
+      current = current->left_child.get();
+    } else {
+      predecessor = current;
+      current = current->right_child.get();
+    }
+  }
+  node_ = predecessor;
+  return *this;
+}
+
+template <typename T, typename Compare>
+PersistentTree<T, Compare>::PersistentTree(
+    std::initializer_list<T> const& items) {
+  for (const auto& item : items) {
+    Insert(item);
+  }
+}
+
+template <typename T, typename Compare>
+typename PersistentTree<T, Compare>::Iterator
+PersistentTree<T, Compare>::begin() const {
+  return Iterator(this, MinimumNode(root_.get()));
+}
+
+template <typename T, typename Compare>
+auto PersistentTree<T, Compare>::Insert(const T& value)
+    -> std::pair<typename PersistentTree<T, Compare>::Iterator, bool> {
+  return InsertValue(value, false);
+}
+
+template <typename T, typename Compare>
+template <typename Key>
+typename PersistentTree<T, Compare>::SizeType PersistentTree<T, Compare>::Erase(
+    const Key& key) {
+  bool erased {false};
+  NodePtr root {EraseFrom(root_, key, &erased)};
+  if (!erased) {
+    return 0;
+  }
+  root_ = std::move(root);
+  return 1;
+}
+
+template <typename T, typename Compare>
+template <typename Key>
+typename PersistentTree<T, Compare>::Iterator PersistentTree<T, Compare>::Find(
+    const Key& key) const {
+  const Node* node {root_.get()};
+  while (node != nullptr) {
+    if (compare_(key, node->value)) {
+      node = node->left_child.get();
+    } else if (compare_(node->value, key)) {
+      node = node->right_child.get();
+    } else {
+      return Iterator(this, node);
+    }
+  }
+  return end();
+}
+
+template <typename T, typename Compare>
+template <typename Key>
+typename PersistentTree<T, Compare>::SizeType PersistentTree<T, Compare>::Rank(
+    const Key& key) const {
+  // number of values less than key
+  SizeType rank {0};
+  const Node* node {root_.get()};
+  while (node != nullptr) {
+    if (compare_(node->value, key)) {
+      rank += SizeOf(node->left_child) + 1;
+      node = node->right_child.get();
+    } else {
+      node = node->left_child.get();
+    }
+  }
+  return rank;
+}
+
+template <typename T, typename Compare>
+void PersistentTree<T, Compare>::Swap(PersistentTree& other) {
+  std::swap(root_, other.root_);
+  std::swap(compare_, other.compare_);
+}
+
+template <typename T, typename Compare>
+template <typename V>
+auto PersistentTree<T, Compare>::InsertValue(V&& value, bool assign)
+    -> std::pair<typename PersistentTree<T, Compare>::Iterator, bool> {
+  bool inserted {false};
+  root_ = InsertInto(root_, value, assign, &inserted);
+  return {Find(value), inserted};
+}
+
+template <typename T, typename Compare>
+template <typename V>
+typename PersistentTree<T, Compare>::NodePtr
+PersistentTree<T, Compare>::InsertInto(const NodePtr& node, V&& value,
+                                       bool assign, bool* inserted) const {
+  // returns node itself when nothing below it changed, so an insert of a
+  // present value copies nothing
+  if (node == nullptr) {
+    *inserted = true;
+    return MakeNode(std::forward<V>(value), nullptr, nullptr);
+  }
+  if (compare_(value, node->value)) {
+    NodePtr left {InsertInto(node->left_child, std::forward<V>(value), assign,
+                             inserted)};
+    if (left == node->left_child) {
+      return node;
+    }
+    return Balance(node->value, std::move(left), node->right_child);
+  }
+  if (compare_(node->value, value)) {
+    NodePtr right {InsertInto(node->right_child, std::forward<V>(value),
+                              assign, inserted)};
+    if (right == node->right_child) {
+      return node;
+    }
+    return Balance(node->value, node->left_child, std::move(right));
+  }
+  if (!assign) {
+    return node;
+  }
+  return MakeNode(std::forward<V>(value), node->left_child, node->right_child);
+}
+
+template <typename T, typename Compare>
+template <typename Key>
+typename PersistentTree<T, Compare>::NodePtr
+PersistentTree<T, Compare>::EraseFrom(const NodePtr& node, const Key& key,
+                                      bool* erased) const {
+  if (node == nullptr) {
+    return node;
+  }
+  if (compare_(key, node->value)) {
+    NodePtr left {EraseFrom(node->left_child, key, erased)};
+    if (!*erased) {
+      return node;
+    }
+    return Balance(node->value, std::move(left), node->right_child);
+  }
+  if (compare_(node->value, key)) {
+    NodePtr right {EraseFrom(node->right_child, key, erased)};
+    if (!*erased) {
+      return node;
+    }
+    return Balance(node->value, node->left_child, std::move(right));
+  }
+  *erased = true;
+  if (node->left_child == nullptr) {
+    return node->right_child;
+  }
+  if (node->right_child == nullptr) {
+    return node->left_child;
+  }
+  const Node* minimum {};
+  NodePtr right {EraseMinimum(node->right_child, &minimum)};
+  return Balance(minimum->value, node->left_child, std::move(right));
+}
+
+template <typename T, typename Compare>
+typename PersistentTree<T, Compare>::NodePtr
+PersistentTree<T, Compare>::EraseMinimum(const NodePtr& node,
+                                         const Node** minimum) {
+  // *minimum stays alive through the node it came from, which the caller's
+  // version still holds
+  if (node->left_child == nullptr) {
+    *minimum = node.get();
+    return node->right_child;
+  }
+  NodePtr left {EraseMinimum(node->left_child, minimum)};
+  return Balance(node->value, std::move(left), node->right_child);
+}
+
+template <typename T, typename Compare>
+typename PersistentTree<T, Compare>::NodePtr
+PersistentTree<T, Compare>::Balance(const T& value, NodePtr left,
+                                    NodePtr right) {
+  // one insert or erase below a balanced node breaks the balance by at most
+  // one step, which a single or double rotation repairs
+  if (IsHeavier(right, left)) {
+    return RotateLeft(value, std::move(left), *right);
+  }
+  if (IsHeavier(left, right)) {
+    return RotateRight(value, *left, std::move(right));
+  }
+  return MakeNode(value, std::move(left), std::move(right));
+}
+
+template <typename T, typename Compare>
+bool PersistentTree<T, Compare>::IsHeavier(const NodePtr& lhs,
+                                           const NodePtr& rhs) {
+  return SizeOf(lhs) + 1 > kDelta * (SizeOf(rhs) + 1);
+}
+
+template <typename T, typename Compare>
+typename PersistentTree<T, Compare>::NodePtr
+PersistentTree<T, Compare>::RotateLeft(const T& value, NodePtr left,
+                                       const Node& right) {
+  const NodePtr& inner {right.left_child};
+  if (SizeOf(inner) + 1 < kGamma * (SizeOf(right.right_child) + 1)) {
+    return MakeNode(right.value, MakeNode(value, std::move(left), inner),
+                    right.right_child);
+  }
+  return MakeNode(
+      inner->value, MakeNode(value, std::move(left), inner->left_child),
+      MakeNode(right.value, inner->right_child, right.right_child));
+}
+
+template <typename T, typename Compare>
+typename PersistentTree<T, Compare>::NodePtr
+PersistentTree<T, Compare>::RotateRight(const T& value, const Node& left,
+                                        NodePtr right) {
+  const NodePtr& inner {left.right_child};
+  if (SizeOf(inner) + 1 < kGamma * (SizeOf(left.left_child) + 1)) {
+    return MakeNode(left.value, left.left_child,
+                    MakeNode(value, inner, std::move(right)));
+  }
+  return MakeNode(
+      inner->value, MakeNode(left.value, left.left_child, inner->left_child),
+      MakeNode(value, inner->right_child, std::move(right)));
+}
+
+template <typename T, typename Compare>
+const typename PersistentTree<T, Compare>::Node*
+PersistentTree<T, Compare>::MinimumNode(const Node* node) {
+  if (node == nullptr) {
+    return node;
+  }
+  while (node->left_child != nullptr) {
+    node = node->left_child.get();
+  }
+  return node;
+}
+
+template <typename T, typename Compare>
+const typename PersistentTree<T, Compare>::Node*
+PersistentTree<T, Compare>::MaximumNode(const Node* node) {
+  if (node == nullptr) {
+    return node;
+  }
+  while (node->right_child != nullptr) {
+    node = node->right_child.get();
+  }
+  return node;
+}
+
+}  // namespace s21
+
+#endif  // SRC_PERSISTENT_TREE_H_
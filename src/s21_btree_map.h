@@ -0,0 +1,100 @@
+#ifndef SRC_S21_BTREE_MAP_H_
+#define SRC_S21_BTREE_MAP_H_
+
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "btree.h"
+#include "map_value_compare.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class BTreeMap : public BTree<std::pair<const Key, T>,
+                              MapValueCompare<Key, T, Compare>> {
+  using Base = BTree<std::pair<const Key, T>,
+                     MapValueCompare<Key, T, Compare>>;
+
+ public:
+  using KeyType = Key;
+  using MappedType = T;
+  using ValueType = std::pair<const Key, T>;
+  using Reference = ValueType&;
+  using ConstReference = const ValueType&;
+  using Iterator = typename Base::Iterator;
+  using ConstIterator = typename Base::ConstIterator;
+  using SizeType = typename Base::SizeType;
+  explicit BTreeMap(std::initializer_list<ValueType> items) : Base(items) {}
+  using Base::Insert;
+  std::pair<Iterator, bool> Insert(const Key& key, const T& obj);
+  std::pair<Iterator, bool> InsertOrAssign(const Key& key, const T& obj);
+
+  T& At(const Key& key);
+  const T& At(const Key& key) const;
+  T& operator[](const Key& key);
+
+  template <typename...  Args>
+  s21::Vector<std::pair<Iterator, bool>> Emplace(Args&&... args);
+};
+
+template <typename Key, typename T, typename Compare>
+auto BTreeMap<Key, T, Compare>::Insert(const Key& key, const T& obj) ->
+    std::pair<typename BTreeMap<Key, T, Compare>::Iterator, bool> {
+  return Insert(ValueType {key, obj});
+}
+
+template <typename Key, typename T, typename Compare>
+auto BTreeMap<Key, T, Compare>::InsertOrAssign(const Key& key, const T& obj) ->
+    std::pair<typename BTreeMap<Key, T, Compare>::Iterator, bool> {
+  auto returnable_pair {Insert(key, obj)};
+  if (returnable_pair.second == false) {
+    Base::ValueAt(returnable_pair.first).second = obj;
+  }
+  return returnable_pair;
+}
+
+template <typename Key, typename T, typename Compare>
+T& BTreeMap<Key, T, Compare>::At(const Key& key) {
+  auto iter {this->Find(key)};
+  if (iter == this->end()) {
+    throw std::out_of_range("There is no key");
+  }
+  return Base::ValueAt(iter).second;
+}
+
+template <typename Key, typename T, typename Compare>
+const T& BTreeMap<Key, T, Compare>::At(const Key& key) const {
+  auto iter {this->Find(key)};
+  if (iter == this->end()) {
+    throw std::out_of_range("There is no key");
+  }
+  return Base::ValueAt(iter).second;
+}
+
+template <typename Key, typename T, typename Compare>
+T& BTreeMap<Key, T, Compare>::operator[](const Key& key) {
+  auto iter {this->Find(key)};
+  if (iter == this->end()) {
+    iter = Insert(key, T{}).first;
+  }
+  return Base::ValueAt(iter).second;
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename...  Args>
+auto BTreeMap<Key, T, Compare>::Emplace(Args&&... args) ->
+    s21::Vector<std::pair<typename BTreeMap<Key, T, Compare>::Iterator, bool>> {
+  s21::Vector<std::pair<Iterator, bool>> returnable_vector{};
+  const ValueType args_data[sizeof...(args)] {args...};
+  for (SizeType i {0}; i < sizeof...(args); ++i) {
+    returnable_vector.PushBack(Insert(args_data[i]));
+  }
+  return returnable_vector;
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_BTREE_MAP_H_
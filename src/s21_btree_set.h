@@ -0,0 +1,45 @@
+#ifndef SRC_S21_BTREE_SET_H_
+#define SRC_S21_BTREE_SET_H_
+
+#include <functional>
+#include <initializer_list>
+
+#include "btree.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+template <typename T, typename Compare = std::less<T>>
+class BTreeSet : public BTree<T, Compare> {
+  using Base = BTree<T, Compare>;
+
+ public:
+  using KeyType = T;
+  using ValueType = T;
+  using Reference = ValueType&;
+  using ConstReference = const ValueType&;
+  using Iterator = typename Base::Iterator;
+  using ConstIterator = typename Base::ConstIterator;
+  using SizeType = typename Base::SizeType;
+  explicit BTreeSet(std::initializer_list<T> items)
+      : Base(items) {}
+
+  template<typename... Args>
+  s21::Vector<std::pair<Iterator, bool>> Emplace(Args&&... args);
+};
+
+template <typename T, typename Compare>
+template <typename... Args>
+Vector<std::pair<typename s21::BTreeSet<T, Compare>::Iterator, bool>>
+BTreeSet<T, Compare>::Emplace(Args&&... args) {
+  s21::Vector<std::pair<Iterator, bool>> returnable_vector{};
+  const ValueType args_data[sizeof...(args)] {args...};
+  for (SizeType i {0}; i < sizeof...(args); ++i) {
+    returnable_vector.PushBack(this->Insert(args_data[i]));
+  }
+  return returnable_vector;
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_BTREE_SET_H_
@@ -0,0 +1,53 @@
+#ifndef SRC_S21_CONCURRENT_SKIP_LIST_MAP_H_
+#define SRC_S21_CONCURRENT_SKIP_LIST_MAP_H_
+
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "concurrent_skip_list.h"
+#include "map_value_compare.h"
+
+namespace s21 {
+
+// Entries cannot change once inserted, since other threads may be reading
+// them: At returns a copy and there is no operator[].
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class ConcurrentSkipListMap
+    : public ConcurrentSkipList<std::pair<const Key, T>,
+                                MapValueCompare<Key, T, Compare>> {
+  using Base = ConcurrentSkipList<std::pair<const Key, T>,
+                                  MapValueCompare<Key, T, Compare>>;
+
+ public:
+  using KeyType = Key;
+  using MappedType = T;
+  using ValueType = std::pair<const Key, T>;
+  using Reference = const ValueType&;
+  using ConstReference = const ValueType&;
+  using Iterator = typename Base::Iterator;
+  using ConstIterator = typename Base::ConstIterator;
+  using SizeType = typename Base::SizeType;
+  ConcurrentSkipListMap() {}
+  explicit ConcurrentSkipListMap(std::initializer_list<ValueType> items)
+      : Base(items) {}
+  using Base::Insert;
+  std::pair<Iterator, bool> Insert(const Key& key, const T& obj) {
+    return Insert(ValueType {key, obj});
+  }
+  T At(const Key& key) const;
+};
+
+template <typename Key, typename T, typename Compare>
+T ConcurrentSkipListMap<Key, T, Compare>::At(const Key& key) const {
+  auto iter {this->Find(key)};
+  if (iter == this->end()) {
+    throw std::out_of_range("There is no key");
+  }
+  return iter->second;
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_CONCURRENT_SKIP_LIST_MAP_H_
@@ -0,0 +1,30 @@
+#ifndef SRC_S21_CONCURRENT_SKIP_LIST_SET_H_
+#define SRC_S21_CONCURRENT_SKIP_LIST_SET_H_
+
+#include <functional>
+#include <initializer_list>
+
+#include "concurrent_skip_list.h"
+
+namespace s21 {
+
+template <typename T, typename Compare = std::less<T>>
+class ConcurrentSkipListSet : public ConcurrentSkipList<T, Compare> {
+  using Base = ConcurrentSkipList<T, Compare>;
+
+ public:
+  using KeyType = T;
+  using ValueType = T;
+  using Reference = const ValueType&;
+  using ConstReference = const ValueType&;
+  using Iterator = typename Base::Iterator;
+  using ConstIterator = typename Base::ConstIterator;
+  using SizeType = typename Base::SizeType;
+  ConcurrentSkipListSet() {}
+  explicit ConcurrentSkipListSet(std::initializer_list<T> items)
+      : Base(items) {}
+};
+
+}  // namespace s21
+
+#endif  // SRC_S21_CONCURRENT_SKIP_LIST_SET_H_
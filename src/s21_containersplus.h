@@ -1,5 +1,16 @@
 #ifndef SRC_S21_CONTAINERSPLUS_H_
 #define SRC_S21_CONTAINERSPLUS_H_
 #include "s21_array.h"
+#include "s21_btree_map.h"
+#include "s21_btree_set.h"
+#include "s21_concurrent_skip_list_map.h"
+#include "s21_concurrent_skip_list_set.h"
+#include "s21_flat_map.h"
+#include "s21_flat_multiset.h"
+#include "s21_flat_set.h"
 #include "s21_multiset.h"
+#include "s21_persistent_map.h"
+#include "s21_persistent_set.h"
+#include "s21_sharded_map.h"
+#include "s21_small_vector.h"
 #endif  // SRC_S21_CONTAINERSPLUS_H_
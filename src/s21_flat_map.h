@@ -0,0 +1,225 @@
+#ifndef SRC_S21_FLAT_MAP_H_
+#define SRC_S21_FLAT_MAP_H_
+
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "flat_tree.h"
+#include "map_value_compare.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Map with the entries kept sorted by key in one Vector. Entries move when
+// the map changes, so unlike Map they are stored as std::pair<Key, T>, with
+// a key that can be assigned; iterators still give only const access.
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class FlatMap
+    : public FlatTree<std::pair<Key, T>,
+                      MapValueCompare<Key, T, Compare, std::pair<Key, T>>> {
+  using Base = FlatTree<std::pair<Key, T>,
+                        MapValueCompare<Key, T, Compare, std::pair<Key, T>>>;
+
+ public:
+  using KeyType = Key;
+  using MappedType = T;
+  using ValueType = std::pair<Key, T>;
+  using Reference = ValueType&;
+  using ConstReference = const ValueType&;
+  using Iterator = typename Base::Iterator;
+  using ConstIterator = typename Base::ConstIterator;
+  using SizeType = typename Base::SizeType;
+  explicit FlatMap(std::initializer_list<ValueType> items) {
+    AssignSorted(items.begin(), items.end());
+  }
+  template <typename InputIt>
+  FlatMap(InputIt first, InputIt last) { AssignSorted(first, last); }
+  std::pair<Iterator, bool> Insert(const ValueType& value) {
+    return this->InsertValue(value, true);
+  }
+  std::pair<Iterator, bool> Insert(const Key& key, const T& obj) {
+    return TryEmplace(key, obj);
+  }
+  Iterator Insert(Iterator hint, const ValueType& value) {
+    return this->InsertWithHint(hint, value, true);
+  }
+  template <typename... Args>
+  Iterator EmplaceHint(Iterator hint, Args&&... args) {
+    return this->InsertWithHint(hint, ValueType(std::forward<Args>(args)...),
+                                true);
+  }
+  std::pair<Iterator, bool> InsertOrAssign(const Key& key, const T& obj);
+  template <typename... Args>
+  std::pair<Iterator, bool> TryEmplace(const Key& key, Args&&... args);
+  Iterator Find(const Key& key) const { return this->FindOf(key); }
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  Iterator Find(const K& key) const { return this->FindOf(key); }
+  using Base::Erase;
+  SizeType Erase(const Key& key);
+  void Merge(FlatMap& other) {  // NOLINT(runtime/references)
+    this->MergeFrom(other, true);
+  }
+  FlatMap Split(const Key& key);
+  FlatMap Union(const FlatMap& other) const;
+  FlatMap Intersection(const FlatMap& other) const;
+  FlatMap Difference(const FlatMap& other) const;
+  FlatMap SymmetricDifference(const FlatMap& other) const;
+  void Join(FlatMap& other) {  // NOLINT(runtime/references)
+    this->JoinWith(other, true);
+  }
+  template <typename InputIt>
+  void AssignSorted(InputIt first, InputIt last) {
+    this->AssignRange(first, last, true);
+  }
+
+  T& At(const Key& key) { return this->ValueAt(FindOrThrow(key)).second; }
+  const T& At(const Key& key) const { return FindOrThrow(key)->second; }
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  T& At(const K& key) { return this->ValueAt(FindOrThrow(key)).second; }
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  const T& At(const K& key) const { return FindOrThrow(key)->second; }
+  T& operator[](const Key& key) {
+    return this->ValueAt(TryEmplace(key).first).second;
+  }
+  bool Contains(const Key& key) const {
+    return this->FindOf(key) != this->end();
+  }
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool Contains(const K& key) const {
+    return this->FindOf(key) != this->end();
+  }
+  SizeType Rank(const Key& key) const { return this->LowerBoundIndex(key); }
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  SizeType Rank(const K& key) const { return this->LowerBoundIndex(key); }
+  SizeType CountRange(const Key& low, const Key& high) const {
+    return this->CountRangeOf(low, high);
+  }
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  SizeType CountRange(const K& low, const K& high) const {
+    return this->CountRangeOf(low, high);
+  }
+
+  template <typename...  Args>
+  s21::Vector<std::pair<Iterator, bool>> Emplace(Args&&... args);
+
+ private:
+  template <typename K>
+  Iterator FindOrThrow(const K& key) const;
+};
+
+template <typename Key, typename T, typename Compare>
+auto FlatMap<Key, T, Compare>::InsertOrAssign(const Key& key, const T& obj) ->
+    std::pair<typename FlatMap<Key, T, Compare>::Iterator, bool> {
+  auto returnable_pair {TryEmplace(key, obj)};
+  if (returnable_pair.second == false) {
+    this->ValueAt(returnable_pair.first).second = obj;
+  }
+  return returnable_pair;
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename... Args>
+auto FlatMap<Key, T, Compare>::TryEmplace(const Key& key, Args&&... args) ->
+    std::pair<typename FlatMap<Key, T, Compare>::Iterator, bool> {
+  SizeType index {this->LowerBoundIndex(key)};
+  if (index < this->Size() && !this->compare_(key, this->values_[index])) {
+    return {this->Select(index), false};
+  }
+  return {this->InsertAt(index, ValueType(
+              std::piecewise_construct, std::forward_as_tuple(key),
+              std::forward_as_tuple(std::forward<Args>(args)...))),
+          true};
+}
+
+template <typename Key, typename T, typename Compare>
+auto FlatMap<Key, T, Compare>::Erase(const Key& key) ->
+    typename FlatMap<Key, T, Compare>::SizeType {
+  auto iter {this->FindOf(key)};
+  if (iter == this->end()) {
+    return 0;
+  }
+  Base::Erase(iter);
+  return 1;
+}
+
+template <typename Key, typename T, typename Compare>
+FlatMap<Key, T, Compare> FlatMap<Key, T, Compare>::Split(const Key& key) {
+  FlatMap rest{};
+  this->SplitInto(key, &rest);
+  return rest;
+}
+
+template <typename Key, typename T, typename Compare>
+FlatMap<Key, T, Compare> FlatMap<Key, T, Compare>::Union(
+    const FlatMap& other) const {
+  FlatMap result{};
+  result.AssignMerged(*this, other, Base::SetOperation::kUnion);
+  return result;
+}
+
+template <typename Key, typename T, typename Compare>
+FlatMap<Key, T, Compare> FlatMap<Key, T, Compare>::Intersection(
+    const FlatMap& other) const {
+  FlatMap result{};
+  result.AssignMerged(*this, other, Base::SetOperation::kIntersection);
+  return result;
+}
+
+template <typename Key, typename T, typename Compare>
+FlatMap<Key, T, Compare> FlatMap<Key, T, Compare>::Difference(
+    const FlatMap& other) const {
+  FlatMap result{};
+  result.AssignMerged(*this, other, Base::SetOperation::kDifference);
+  return result;
+}
+
+template <typename Key, typename T, typename Compare>
+FlatMap<Key, T, Compare> FlatMap<Key, T, Compare>::SymmetricDifference(
+    const FlatMap& other) const {
+  FlatMap result{};
+  result.AssignMerged(*this, other, Base::SetOperation::kSymmetricDifference);
+  return result;
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K>
+auto FlatMap<Key, T, Compare>::FindOrThrow(const K& key) const ->
+    typename FlatMap<Key, T, Compare>::Iterator {
+  auto iter {this->FindOf(key)};
+  if (iter == this->end()) {
+    throw std::out_of_range("There is no key");
+  }
+  return iter;
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename...  Args>
+auto FlatMap<Key, T, Compare>::Emplace(Args&&... args) ->
+    s21::Vector<std::pair<typename FlatMap<Key, T, Compare>::Iterator,
+                          bool>> {
+  // every insert may move the entries, so the iterators are looked up once
+  // all of them are in
+  s21::Vector<std::pair<Iterator, bool>> returnable_vector{};
+  const ValueType args_data[sizeof...(args)] {args...};
+  bool inserted[sizeof...(args)] {};
+  for (SizeType i {0}; i < sizeof...(args); ++i) {
+    inserted[i] = Insert(args_data[i]).second;
+  }
+  for (SizeType i {0}; i < sizeof...(args); ++i) {
+    returnable_vector.PushBack({Find(args_data[i].first), inserted[i]});
+  }
+  return returnable_vector;
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_FLAT_MAP_H_
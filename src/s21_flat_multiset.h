@@ -0,0 +1,143 @@
+#ifndef SRC_S21_FLAT_MULTISET_H_
+#define SRC_S21_FLAT_MULTISET_H_
+
+#include <functional>
+#include <initializer_list>
+#include <utility>
+
+#include "flat_tree.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Multiset with every occurrence stored in one sorted Vector, equal values
+// next to each other in insertion order.
+template <typename T, typename Compare = std::less<T>>
+class FlatMultiset : public FlatTree<T, Compare> {
+  using Base = FlatTree<T, Compare>;
+
+ public:
+  using KeyType = T;
+  using ValueType = T;
+  using Reference = ValueType&;
+  using ConstReference = const ValueType&;
+  using Iterator = typename Base::Iterator;
+  using ConstIterator = typename Base::ConstIterator;
+  using SizeType = typename Base::SizeType;
+  explicit FlatMultiset(std::initializer_list<T> const& items) {
+    this->AssignSorted(items.begin(), items.end());
+  }
+  template <typename InputIt>
+  FlatMultiset(InputIt first, InputIt last) {
+    this->AssignSorted(first, last);
+  }
+  void Merge(FlatMultiset& other) {  // NOLINT(runtime/references)
+    this->MergeFrom(other, false);
+  }
+  FlatMultiset Split(const T& key);
+  FlatMultiset Union(const FlatMultiset& other) const;
+  FlatMultiset Intersection(const FlatMultiset& other) const;
+  FlatMultiset Difference(const FlatMultiset& other) const;
+  FlatMultiset SymmetricDifference(const FlatMultiset& other) const;
+  void Join(FlatMultiset& other) {  // NOLINT(runtime/references)
+    this->JoinWith(other, false);
+  }
+
+  SizeType Count(const T& key) const { return CountOf(key); }
+  std::pair<Iterator, Iterator> EqualRange(const T& key) const {
+    return {LowerBound(key), UpperBound(key)};
+  }
+  Iterator LowerBound(const T& key) const {
+    return this->Select(this->LowerBoundIndex(key));
+  }
+  Iterator UpperBound(const T& key) const {
+    return this->Select(this->UpperBoundIndex(key));
+  }
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  SizeType Count(const K& key) const { return CountOf(key); }
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<Iterator, Iterator> EqualRange(const K& key) const {
+    return {LowerBound(key), UpperBound(key)};
+  }
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  Iterator LowerBound(const K& key) const {
+    return this->Select(this->LowerBoundIndex(key));
+  }
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  Iterator UpperBound(const K& key) const {
+    return this->Select(this->UpperBoundIndex(key));
+  }
+
+  template <typename... Args>
+  s21::Vector<Iterator> Emplace(Args&&... args);
+
+ private:
+  template <typename K>
+  SizeType CountOf(const K& key) const {
+    return this->UpperBoundIndex(key) - this->LowerBoundIndex(key);
+  }
+};
+
+template <typename T, typename Compare>
+FlatMultiset<T, Compare> FlatMultiset<T, Compare>::Split(const T& key) {
+  FlatMultiset rest{};
+  this->SplitInto(key, &rest);
+  return rest;
+}
+
+template <typename T, typename Compare>
+FlatMultiset<T, Compare> FlatMultiset<T, Compare>::Union(
+    const FlatMultiset& other) const {
+  FlatMultiset result{};
+  result.AssignMerged(*this, other, Base::SetOperation::kUnion);
+  return result;
+}
+
+template <typename T, typename Compare>
+FlatMultiset<T, Compare> FlatMultiset<T, Compare>::Intersection(
+    const FlatMultiset& other) const {
+  FlatMultiset result{};
+  result.AssignMerged(*this, other, Base::SetOperation::kIntersection);
+  return result;
+}
+
+template <typename T, typename Compare>
+FlatMultiset<T, Compare> FlatMultiset<T, Compare>::Difference(
+    const FlatMultiset& other) const {
+  FlatMultiset result{};
+  result.AssignMerged(*this, other, Base::SetOperation::kDifference);
+  return result;
+}
+
+template <typename T, typename Compare>
+FlatMultiset<T, Compare> FlatMultiset<T, Compare>::SymmetricDifference(
+    const FlatMultiset& other) const {
+  FlatMultiset result{};
+  result.AssignMerged(*this, other, Base::SetOperation::kSymmetricDifference);
+  return result;
+}
+
+template <typename T, typename Compare>
+template <typename... Args>
+Vector<typename FlatMultiset<T, Compare>::Iterator>
+FlatMultiset<T, Compare>::Emplace(Args&&... args) {
+  // every insert may move the values, so each iterator is taken once all of
+  // them are in; it points at the last occurrence of its value
+  s21::Vector<Iterator> returnable_vector{};
+  const ValueType args_data[sizeof...(args)] {args...};
+  for (SizeType i {0}; i < sizeof...(args); ++i) {
+    this->Insert(args_data[i]);
+  }
+  for (SizeType i {0}; i < sizeof...(args); ++i) {
+    returnable_vector.PushBack(--UpperBound(args_data[i]));
+  }
+  return returnable_vector;
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_FLAT_MULTISET_H_
@@ -0,0 +1,121 @@
+#ifndef SRC_S21_FLAT_SET_H_
+#define SRC_S21_FLAT_SET_H_
+
+#include <functional>
+#include <initializer_list>
+#include <utility>
+
+#include "flat_tree.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Set with the values kept sorted in one Vector: smaller and faster to
+// search than Set, slower to change one value at a time. Build it in bulk
+// from a range where possible.
+template <typename T, typename Compare = std::less<T>>
+class FlatSet : public FlatTree<T, Compare> {
+  using Base = FlatTree<T, Compare>;
+
+ public:
+  using KeyType = T;
+  using ValueType = T;
+  using Reference = ValueType&;
+  using ConstReference = const ValueType&;
+  using Iterator = typename Base::Iterator;
+  using ConstIterator = typename Base::ConstIterator;
+  using SizeType = typename Base::SizeType;
+  explicit FlatSet(std::initializer_list<T> items) {
+    AssignSorted(items.begin(), items.end());
+  }
+  template <typename InputIt>
+  FlatSet(InputIt first, InputIt last) { AssignSorted(first, last); }
+  std::pair<Iterator, bool> Insert(const T& value) {
+    return this->InsertValue(value, true);
+  }
+  Iterator Insert(Iterator hint, const T& value) {
+    return this->InsertWithHint(hint, value, true);
+  }
+  template <typename... Args>
+  Iterator EmplaceHint(Iterator hint, Args&&... args) {
+    return this->InsertWithHint(hint, T(std::forward<Args>(args)...), true);
+  }
+  template <typename InputIt>
+  void AssignSorted(InputIt first, InputIt last) {
+    this->AssignRange(first, last, true);
+  }
+  void Merge(FlatSet& other) {  // NOLINT(runtime/references)
+    this->MergeFrom(other, true);
+  }
+  FlatSet Split(const T& key);
+  FlatSet Union(const FlatSet& other) const;
+  FlatSet Intersection(const FlatSet& other) const;
+  FlatSet Difference(const FlatSet& other) const;
+  FlatSet SymmetricDifference(const FlatSet& other) const;
+  void Join(FlatSet& other) {  // NOLINT(runtime/references)
+    this->JoinWith(other, true);
+  }
+
+  template<typename... Args>
+  s21::Vector<std::pair<Iterator, bool>> Emplace(Args&&... args);
+};
+
+template <typename T, typename Compare>
+FlatSet<T, Compare> FlatSet<T, Compare>::Split(const T& key) {
+  FlatSet rest{};
+  this->SplitInto(key, &rest);
+  return rest;
+}
+
+template <typename T, typename Compare>
+FlatSet<T, Compare> FlatSet<T, Compare>::Union(const FlatSet& other) const {
+  FlatSet result{};
+  result.AssignMerged(*this, other, Base::SetOperation::kUnion);
+  return result;
+}
+
+template <typename T, typename Compare>
+FlatSet<T, Compare> FlatSet<T, Compare>::Intersection(
+    const FlatSet& other) const {
+  FlatSet result{};
+  result.AssignMerged(*this, other, Base::SetOperation::kIntersection);
+  return result;
+}
+
+template <typename T, typename Compare>
+FlatSet<T, Compare> FlatSet<T, Compare>::Difference(
+    const FlatSet& other) const {
+  FlatSet result{};
+  result.AssignMerged(*this, other, Base::SetOperation::kDifference);
+  return result;
+}
+
+template <typename T, typename Compare>
+FlatSet<T, Compare> FlatSet<T, Compare>::SymmetricDifference(
+    const FlatSet& other) const {
+  FlatSet result{};
+  result.AssignMerged(*this, other, Base::SetOperation::kSymmetricDifference);
+  return result;
+}
+
+template <typename T, typename Compare>
+template <typename... Args>
+Vector<std::pair<typename s21::FlatSet<T, Compare>::Iterator, bool>>
+FlatSet<T, Compare>::Emplace(Args&&... args) {
+  // every insert may move the values, so the iterators are looked up once
+  // all of them are in
+  s21::Vector<std::pair<Iterator, bool>> returnable_vector{};
+  const ValueType args_data[sizeof...(args)] {args...};
+  bool inserted[sizeof...(args)] {};
+  for (SizeType i {0}; i < sizeof...(args); ++i) {
+    inserted[i] = Insert(args_data[i]).second;
+  }
+  for (SizeType i {0}; i < sizeof...(args); ++i) {
+    returnable_vector.PushBack({this->Find(args_data[i]), inserted[i]});
+  }
+  return returnable_vector;
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_FLAT_SET_H_
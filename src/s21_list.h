@@ -4,12 +4,24 @@
 #include <cstddef>
 #include <initializer_list>
 #include <limits>
+#include <memory>
+#include <memory_resource>
+#include <new>
 #include <utility>
 
+#include "allocator_holder.h"
+
 namespace s21 {
 
-template <typename T>
-class List {
+// Nodes come from the allocator, rebound to the node type. Copies pick
+// their allocator as the allocator traits say. Moves and splices take the
+// nodes over when the allocators compare equal; otherwise a move moves
+// the values into nodes of its own and a splice copies them.
+template <typename T, typename Allocator = std::allocator<T>>
+class List : private AllocatorHolder<Allocator> {
+  using AllocatorBase = AllocatorHolder<Allocator>;
+  using AllocatorBase::StoredAllocator;
+
  public:
   using ValueType = T;
   using Rerefence = T&;
@@ -19,14 +31,18 @@ class List {
   using Iterator = ListIterator;
   using ConstIterator = ConstListIterator;
   using SizeType = std::size_t;
-  List();
-  explicit List(SizeType n);
-  explicit List(std::initializer_list<T> const& items);
+  using AllocatorType = Allocator;
+  List() : List(Allocator()) {}
+  explicit List(const Allocator& allocator);
+  explicit List(SizeType n, const Allocator& allocator = Allocator());
+  explicit List(std::initializer_list<T> const& items,
+                const Allocator& allocator = Allocator());
   List(const List& other);
   List(List&& other);
   List& operator=(const List& other);
   List& operator=(List&& other);
   ~List();
+  Allocator GetAllocator() const { return StoredAllocator(); }
 
   T& Front();
   T& Back();
@@ -46,6 +62,7 @@ class List {
   Iterator Insert(Iterator pos, const T& value);
   void Erase(Iterator pos);
   void PushBack(const T& value);
+  void PushBack(T&& value);
   void PopBack();
   void PushFront(const T& value);
   void PopFront();
@@ -69,6 +86,15 @@ class List {
     Node* prev{nullptr};
     Node* next{nullptr};
   };
+  using NodeAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using NodeTraits = std::allocator_traits<NodeAllocator>;
+  template <typename Value>
+  Node* NewNode(Value&& value);
+  void DeleteNode(Node* node);
+  void AppendNode(Node* new_node);
+  void MoveValuesFrom(List& other);  // NOLINT(runtime/references)
+  void SwapNodes(List& other);  // NOLINT(runtime/references)
   void SwapNodes(Iterator first, Iterator Second);
   void BindNodes(Node* first, Node* second);
   void SwapNodesByPointers(Node* first, Node* second);
@@ -81,8 +107,8 @@ class List {
   SizeType list_size_{};
 };
 
-template <typename T>
-class List<T>::ListIterator {
+template <typename T, typename Allocator>
+class List<T, Allocator>::ListIterator {
  public:
   ListIterator()
       : node_ptr_ {nullptr} {}
@@ -135,8 +161,9 @@ class List<T>::ListIterator {
   Node* node_ptr_{};
 };
 
-template <typename T>
-class List<T>::ConstListIterator : public List<T>::Iterator {
+template <typename T, typename Allocator>
+class List<T, Allocator>::ConstListIterator
+    : public List<T, Allocator>::Iterator {
  public:
   explicit ConstListIterator(Node* node) : Iterator { node } {}
   const T& operator*() const {
@@ -144,36 +171,52 @@ class List<T>::ConstListIterator : public List<T>::Iterator {
   }
 };
 
-template <typename T>
-List<T>::List() : list_size_ {0} {
-  pseudo_node_ptr_ = new Node {T{}, last_node_ptr_, nullptr};
+template <typename T, typename Allocator>
+List<T, Allocator>::List(const Allocator& allocator)
+    : AllocatorBase(allocator), list_size_ {0} {
+  pseudo_node_ptr_ = NewNode(T{});
   first_node_ptr_ = pseudo_node_ptr_;
 }
 
-template <typename T>
-List<T>::List(SizeType n) : List() {
+template <typename T, typename Allocator>
+List<T, Allocator>::List(SizeType n, const Allocator& allocator)
+    : List(allocator) {
   for (SizeType i {0}; i < n; ++i) {
     PushBack(T{});
   }
 }
 
-template <typename T>
-List<T>::List(std::initializer_list<T> const& items) : List() {
+template <typename T, typename Allocator>
+List<T, Allocator>::List(std::initializer_list<T> const& items,
+                         const Allocator& allocator)
+    : List(allocator) {
   for (const auto& item : items) {
     PushBack(item);
   }
 }
 
-template <typename T>
-List<T>::List(const List& other) : List() {
-  *this = other;
+template <typename T, typename Allocator>
+List<T, Allocator>::List(const List& other)
+    : List(std::allocator_traits<Allocator>::
+               select_on_container_copy_construction(other.GetAllocator())) {
+  for (const auto& item : other) {
+    PushBack(item);
+  }
 }
 
-template <typename T>
-List<T>& List<T>::operator=(const List& other) {
+template <typename T, typename Allocator>
+List<T, Allocator>& List<T, Allocator>::operator=(const List& other) {
   if (this == &other) {
     return *this;
   }
+  if constexpr (NodeTraits::propagate_on_container_copy_assignment::value) {
+    if (!(StoredAllocator() == other.StoredAllocator())) {
+      // the old nodes go away with the old allocator in replacement
+      List replacement(other.GetAllocator());
+      SwapNodes(replacement);
+      std::swap(StoredAllocator(), replacement.StoredAllocator());
+    }
+  }
   Clear();
   for (const auto& i : other) {
     PushBack(i);
@@ -181,67 +224,75 @@ List<T>& List<T>::operator=(const List& other) {
   return *this;
 }
 
-template <typename T>
-List<T>::List(List&& other) : List() {
-  *this = std::move(other);
+template <typename T, typename Allocator>
+List<T, Allocator>::List(List&& other) : List(other.GetAllocator()) {
+  SwapNodes(other);
 }
 
-template <typename T>
-List<T>& List<T>::operator=(List&& other) {
+template <typename T, typename Allocator>
+List<T, Allocator>& List<T, Allocator>::operator=(List&& other) {
   if (this == &other) {
     return *this;
   }
-  Swap(other);
+  if constexpr (NodeTraits::propagate_on_container_move_assignment::value) {
+    SwapNodes(other);
+    std::swap(StoredAllocator(), other.StoredAllocator());
+  } else if (StoredAllocator() == other.StoredAllocator()) {
+    SwapNodes(other);
+  } else {
+    MoveValuesFrom(other);
+  }
   return *this;
 }
 
-template <typename T>
-List<T>::~List() {
+template <typename T, typename Allocator>
+List<T, Allocator>::~List() {
   Clear();
-  delete pseudo_node_ptr_;
+  DeleteNode(pseudo_node_ptr_);
 }
 
-template <typename T>
-T& List<T>::Front() {
+template <typename T, typename Allocator>
+T& List<T, Allocator>::Front() {
   if (first_node_ptr_ != nullptr) {
     return first_node_ptr_->value;
   }
   return pseudo_node_ptr_->value;
 }
 
-template <typename T>
-T& List<T>::Back() {
+template <typename T, typename Allocator>
+T& List<T, Allocator>::Back() {
   if (last_node_ptr_ != nullptr) {
     return last_node_ptr_->value;
   }
   return pseudo_node_ptr_->value;
 }
 
-template <typename T>
-const T& List<T>::Front() const {
+template <typename T, typename Allocator>
+const T& List<T, Allocator>::Front() const {
   if (first_node_ptr_ != nullptr) {
     return first_node_ptr_->value;
   }
   return pseudo_node_ptr_->value;
 }
 
-template <typename T>
-const T& List<T>::Back() const {
+template <typename T, typename Allocator>
+const T& List<T, Allocator>::Back() const {
   if (last_node_ptr_ != nullptr) {
     return last_node_ptr_->value;
   }
   return pseudo_node_ptr_->value;
 }
 
-template <typename T>
-void List<T>::Clear() {
+template <typename T, typename Allocator>
+void List<T, Allocator>::Clear() {
   while (last_node_ptr_ != nullptr) {
     PopBack();
   }
 }
 
-template <typename T>
-typename List<T>::Iterator List<T>::Insert(Iterator pos, const T& value) {
+template <typename T, typename Allocator>
+typename List<T, Allocator>::Iterator List<T, Allocator>::Insert(
+    Iterator pos, const T& value) {
   if (pos == begin()) {
     PushFront(value);
     return begin();
@@ -250,15 +301,15 @@ typename List<T>::Iterator List<T>::Insert(Iterator pos, const T& value) {
     PushBack(value);
     return --end();
   }
-  Node* new_node {new Node {value, nullptr, nullptr}};
+  Node* new_node {NewNode(value)};
   BindNodes(pos.node_ptr_->prev, new_node);
   BindNodes(new_node, pos.node_ptr_);
   ++list_size_;
   return --pos;
 }
 
-template <typename T>
-void List<T>::Erase(Iterator pos) {
+template <typename T, typename Allocator>
+void List<T, Allocator>::Erase(Iterator pos) {
   if (pos == begin()) {
     PopFront();
   } else if (pos == --end()) {
@@ -266,15 +317,24 @@ void List<T>::Erase(Iterator pos) {
   } else {
     Node* iterator_node_ptr {pos.node_ptr_};
     BindNodes(iterator_node_ptr->prev, iterator_node_ptr->next);
-    delete iterator_node_ptr;
+    DeleteNode(iterator_node_ptr);
     iterator_node_ptr = nullptr;
     --list_size_;
   }
 }
 
-template <typename T>
-void List<T>::PushBack(const T& value) {
-  Node* new_node {new Node {value, nullptr, nullptr}};
+template <typename T, typename Allocator>
+void List<T, Allocator>::PushBack(const T& value) {
+  AppendNode(NewNode(value));
+}
+
+template <typename T, typename Allocator>
+void List<T, Allocator>::PushBack(T&& value) {
+  AppendNode(NewNode(std::move(value)));
+}
+
+template <typename T, typename Allocator>
+void List<T, Allocator>::AppendNode(Node* new_node) {
   BindNodes(new_node, pseudo_node_ptr_);
   if (last_node_ptr_ == nullptr) {
     first_node_ptr_ = new_node;
@@ -285,15 +345,15 @@ void List<T>::PushBack(const T& value) {
   ++list_size_;
 }
 
-template <typename T>
-void List<T>::PopBack() {
+template <typename T, typename Allocator>
+void List<T, Allocator>::PopBack() {
   if (last_node_ptr_ != nullptr) {
     if (last_node_ptr_->prev != nullptr) {
       last_node_ptr_ = last_node_ptr_->prev;
-      delete last_node_ptr_->next;
+      DeleteNode(last_node_ptr_->next);
       BindNodes(last_node_ptr_, pseudo_node_ptr_);
     } else {
-      delete last_node_ptr_;
+      DeleteNode(last_node_ptr_);
       last_node_ptr_ = nullptr;
       first_node_ptr_ = nullptr;
     }
@@ -301,9 +361,9 @@ void List<T>::PopBack() {
   }
 }
 
-template <typename T>
-void List<T>::PushFront(const T& value) {
-  Node* new_node {new Node {value, nullptr, nullptr}};
+template <typename T, typename Allocator>
+void List<T, Allocator>::PushFront(const T& value) {
+  Node* new_node {NewNode(value)};
   BindNodes(new_node, first_node_ptr_);
   first_node_ptr_ = new_node;
   if (last_node_ptr_ == nullptr) {
@@ -313,15 +373,15 @@ void List<T>::PushFront(const T& value) {
   ++list_size_;
 }
 
-template <typename T>
-void List<T>::PopFront() {
+template <typename T, typename Allocator>
+void List<T, Allocator>::PopFront() {
   if (first_node_ptr_ != nullptr) {
     if (first_node_ptr_->next != pseudo_node_ptr_) {
       first_node_ptr_ = first_node_ptr_->next;
-      delete first_node_ptr_->prev;
+      DeleteNode(first_node_ptr_->prev);
       first_node_ptr_->prev = nullptr;
     } else {
-      delete first_node_ptr_;
+      DeleteNode(first_node_ptr_);
       first_node_ptr_ = nullptr;
       last_node_ptr_ = nullptr;
     }
@@ -329,28 +389,46 @@ void List<T>::PopFront() {
   }
 }
 
-template <typename T>
-void List<T>::Swap(List& other) {
+template <typename T, typename Allocator>
+void List<T, Allocator>::Swap(List& other) {
   if (this == &other) {
     return;
   }
+  SwapNodes(other);
+  if constexpr (NodeTraits::propagate_on_container_swap::value) {
+    std::swap(StoredAllocator(), other.StoredAllocator());
+  }
+}
+
+template <typename T, typename Allocator>
+void List<T, Allocator>::SwapNodes(List& other) {
   std::swap(first_node_ptr_, other.first_node_ptr_);
   std::swap(last_node_ptr_, other.last_node_ptr_);
   std::swap(pseudo_node_ptr_, other.pseudo_node_ptr_);
   std::swap(list_size_, other.list_size_);
 }
 
-template <typename T>
-void List<T>::Reverse() {
-  List<T> tmp_list;
+template <typename T, typename Allocator>
+void List<T, Allocator>::MoveValuesFrom(List& other) {
+  // for lists whose allocators differ, which cannot hand nodes over
+  Clear();
+  for (auto& item : other) {
+    PushBack(std::move(item));
+  }
+  other.Clear();
+}
+
+template <typename T, typename Allocator>
+void List<T, Allocator>::Reverse() {
+  List tmp_list(GetAllocator());
   for (const auto& iter : *this) {
     tmp_list.PushFront(iter);
   }
   Swap(tmp_list);
 }
 
-template <typename T>
-void List<T>::Merge(List& other) {  // NOLINT(runtime/references)
+template <typename T, typename Allocator>
+void List<T, Allocator>::Merge(List& other) {  // NOLINT(runtime/references)
   if (this == &other) {
     return;
   }
@@ -369,14 +447,22 @@ void List<T>::Merge(List& other) {  // NOLINT(runtime/references)
   }
 }
 
-template <typename T>
-void List<T>::Splice(ConstIterator pos, List& other) {  // NOLINT(runtime/references)
+template <typename T, typename Allocator>
+void List<T, Allocator>::Splice(
+    ConstIterator pos, List& other) {  // NOLINT(runtime/references)
   if (this == &other) {
     return;
   }
   if (other.Empty()) {
     return;
   }
+  if (!(StoredAllocator() == other.StoredAllocator())) {
+    for (const auto& item : other) {
+      Insert(pos, item);
+    }
+    other.Clear();
+    return;
+  }
   if (pos == begin()) {
     first_node_ptr_ = other.first_node_ptr_;
   }
@@ -391,8 +477,8 @@ void List<T>::Splice(ConstIterator pos, List& other) {  // NOLINT(runtime/refere
   other.last_node_ptr_ = nullptr;
 }
 
-template <typename T>
-void List<T>::Unique() {
+template <typename T, typename Allocator>
+void List<T, Allocator>::Unique() {
   for (auto iter {begin()}; iter != end(); ++iter) {
     auto inner_iter {iter};
     ++inner_iter;
@@ -406,8 +492,8 @@ void List<T>::Unique() {
   }
 }
 
-template <typename T>
-void List<T>::Sort() {
+template <typename T, typename Allocator>
+void List<T, Allocator>::Sort() {
   for (auto iter {begin()}; iter != end(); ) {
     bool no_swap {true};
     for (auto inner_iter {iter}; inner_iter != end(); ++inner_iter) {
@@ -423,15 +509,16 @@ void List<T>::Sort() {
   }
 }
 
-template <typename T>
-void List<T>::SwapNodes(Iterator first, Iterator second) {
+template <typename T, typename Allocator>
+void List<T, Allocator>::SwapNodes(Iterator first, Iterator second) {
   // first must be before second, otherwise the list will be looped
   SwapNodesByPointers(first.node_ptr_, second.node_ptr_);
 }
 
-template <typename T>
+template <typename T, typename Allocator>
 template <typename... Args>
-typename List<T>::Iterator List<T>::Emplace(ConstIterator pos, Args&&... args) {
+typename List<T, Allocator>::Iterator List<T, Allocator>::Emplace(
+    ConstIterator pos, Args&&... args) {
   T args_data[sizeof...(Args)] {args...};
   for (SizeType i {0}; i < sizeof...(Args); ++i) {
     Insert(pos, args_data[i]);
@@ -439,20 +526,42 @@ typename List<T>::Iterator List<T>::Emplace(ConstIterator pos, Args&&... args) {
   return pos;
 }
 
-template <typename T>
+template <typename T, typename Allocator>
 template <typename... Args>
-void List<T>::EmplaceFront(Args&&... args) {
+void List<T, Allocator>::EmplaceFront(Args&&... args) {
   Emplace(begin(), args...);
 }
 
-template <typename T>
+template <typename T, typename Allocator>
 template <typename... Args>
-void List<T>::EmplaceBack(Args&&... args) {
+void List<T, Allocator>::EmplaceBack(Args&&... args) {
   Emplace(end(), args...);
 }
 
-template <typename T>
-void List<T>::BindNodes(Node* first, Node* second) {
+template <typename T, typename Allocator>
+template <typename Value>
+typename List<T, Allocator>::Node* List<T, Allocator>::NewNode(Value&& value) {
+  NodeAllocator allocator {StoredAllocator()};
+  Node* node {NodeTraits::allocate(allocator, 1)};
+  try {
+    ::new (static_cast<void*>(node))
+        Node {std::forward<Value>(value), nullptr, nullptr};
+  } catch (...) {
+    NodeTraits::deallocate(allocator, node, 1);
+    throw;
+  }
+  return node;
+}
+
+template <typename T, typename Allocator>
+void List<T, Allocator>::DeleteNode(Node* node) {
+  node->~Node();
+  NodeAllocator allocator {StoredAllocator()};
+  NodeTraits::deallocate(allocator, node, 1);
+}
+
+template <typename T, typename Allocator>
+void List<T, Allocator>::BindNodes(Node* first, Node* second) {
   if (first != nullptr) {
     first->next = second;
   }
@@ -461,8 +570,8 @@ void List<T>::BindNodes(Node* first, Node* second) {
   }
 }
 
-template <typename T>
-void List<T>::SwapNodesByPointers(Node* first, Node* second) {
+template <typename T, typename Allocator>
+void List<T, Allocator>::SwapNodesByPointers(Node* first, Node* second) {
   // first must be before second, otherwise the list will be looped
   if (Size() < 2) {
     return;
@@ -481,8 +590,8 @@ void List<T>::SwapNodesByPointers(Node* first, Node* second) {
   SetFirstAndLastNodePointers(first, second);
 }
 
-template <typename T>
-void List<T>::SwapNeighboringNodes(Node* first, Node* second) {
+template <typename T, typename Allocator>
+void List<T, Allocator>::SwapNeighboringNodes(Node* first, Node* second) {
   first->next = second->next;
   first->next->prev = first;
   second->prev = first->prev;
@@ -493,8 +602,8 @@ void List<T>::SwapNeighboringNodes(Node* first, Node* second) {
   second->next = first;
 }
 
-template <typename T>
-void List<T>::SwapDistantingNodes(Node* first, Node* second) {
+template <typename T, typename Allocator>
+void List<T, Allocator>::SwapDistantingNodes(Node* first, Node* second) {
   if (first->prev != nullptr) {
     std::swap(first->prev->next, second->prev->next);
   } else {
@@ -505,8 +614,9 @@ void List<T>::SwapDistantingNodes(Node* first, Node* second) {
   std::swap(first->next, second->next);
 }
 
-template <typename T>
-void List<T>::SetFirstAndLastNodePointers(Node* first, Node* second) {
+template <typename T, typename Allocator>
+void List<T, Allocator>::SetFirstAndLastNodePointers(Node* first,
+                                                     Node* second) {
   if (first_node_ptr_ == first) {
     first_node_ptr_ = second;
   }
@@ -515,6 +625,13 @@ void List<T>::SetFirstAndLastNodePointers(Node* first, Node* second) {
   }
 }
 
+namespace pmr {
+
+template <typename T>
+using List = s21::List<T, std::pmr::polymorphic_allocator<T>>;
+
+}  // namespace pmr
+
 }  // namespace s21
 
 #endif  // SRC_S21_LIST_H_
@@ -2,135 +2,274 @@
 #define SRC_S21_MAP_H_
 
 #include <cstddef>
+#include <functional>
 #include <initializer_list>
 #include <limits>
+#include <memory>
+#include <memory_resource>
 #include <stdexcept>
+#include <tuple>
+#include <utility>
 
 #include "binary_search_tree.h"
+#include "map_value_compare.h"
 #include "s21_vector.h"
 
 namespace s21 {
 
-template <typename Key, typename T>
-class Map : public BinarySearchTree<std::pair<const Key, T>> {
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
+class Map : public BinarySearchTree<std::pair<const Key, T>,
+                                    MapValueCompare<Key, T, Compare>,
+                                    Allocator> {
+  using Base = BinarySearchTree<std::pair<const Key, T>,
+                                MapValueCompare<Key, T, Compare>, Allocator>;
+  using Node = typename Base::Node;
+
  public:
   using KeyType = Key;
   using MappedType = T;
   using ValueType = std::pair<const Key, T>;
   using Reference = ValueType&;
   using ConstReference = const ValueType&;
-  using Iterator = typename BinarySearchTree<ValueType>::Iterator;
-  using ConstIterator = typename BinarySearchTree<ValueType>::ConstIterator;
-  using SizeType = typename BinarySearchTree<ValueType>::SizeType;
-  explicit Map(std::initializer_list<ValueType> items);
+  using Iterator = typename Base::Iterator;
+  using ConstIterator = typename Base::ConstIterator;
+  using SizeType = typename Base::SizeType;
+  using AllocatorType = Allocator;
+  explicit Map(const Allocator& allocator) : Base(allocator) {}
+  explicit Map(std::initializer_list<ValueType> items,
+               const Allocator& allocator = Allocator());
+  template <typename InputIt>
+  Map(InputIt first, InputIt last, const Allocator& allocator = Allocator())
+      : Base(allocator) {
+    AssignSorted(first, last);
+  }
   std::pair<Iterator, bool> Insert(const ValueType& value);
   std::pair<Iterator, bool> Insert(const Key& key, const T& obj);
+  Iterator Insert(Iterator hint, const ValueType& value);
+  template <typename... Args>
+  Iterator EmplaceHint(Iterator hint, Args&&... args);
   std::pair<Iterator, bool> InsertOrAssign(const Key& key, const T& obj);
+  template <typename... Args>
+  std::pair<Iterator, bool> TryEmplace(const Key& key, Args&&... args);
   Iterator Find(const Key& key) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  Iterator Find(const K& key) const {
+    return this->MakeIterator(this->FindNode(key));
+  }
+  using Base::Erase;
+  SizeType Erase(const Key& key);
   void Merge(Map& other);  // NOLINT(runtime/references)
+  Map Split(const Key& key);
+  Map Union(const Map& other) const;
+  Map Intersection(const Map& other) const;
+  Map Difference(const Map& other) const;
+  Map SymmetricDifference(const Map& other) const;
+  void Join(Map& other);  // NOLINT(runtime/references)
+  template <typename InputIt>
+  void AssignSorted(InputIt first, InputIt last);
 
-  T& At(const Key& key);
-  const T& At(const Key& key) const;
+  T& At(const Key& key) { return FindOrThrow(key)->value.second; }
+  const T& At(const Key& key) const {
+    return FindOrThrow(key)->value.second;
+  }
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  T& At(const K& key) { return FindOrThrow(key)->value.second; }
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  const T& At(const K& key) const {
+    return FindOrThrow(key)->value.second;
+  }
   T& operator[](const Key& key);
-  bool Contains(const Key& key) const { return Find(key) != this->end(); }
+  bool Contains(const Key& key) const { return this->FindNode(key) != nullptr; }
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool Contains(const K& key) const { return this->FindNode(key) != nullptr; }
+  SizeType Rank(const Key& key) const { return this->RankOf(key); }
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  SizeType Rank(const K& key) const { return this->RankOf(key); }
+  SizeType CountRange(const Key& low, const Key& high) const {
+    return this->CountRangeOf(low, high);
+  }
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  SizeType CountRange(const K& low, const K& high) const {
+    return this->CountRangeOf(low, high);
+  }
 
   template <typename...  Args>
   s21::Vector<std::pair<Iterator, bool>> Emplace(Args&&... args);
+
+ private:
+  template <typename K>
+  Node* FindOrThrow(const K& key) const;
 };
 
-template <typename Key, typename T>
-Map<Key, T>::Map(std::initializer_list<ValueType> items) {
+template <typename Key, typename T, typename Compare, typename Allocator>
+Map<Key, T, Compare, Allocator>::Map(std::initializer_list<ValueType> items,
+                                     const Allocator& allocator)
+    : Base(allocator) {
   for (const auto& item : items) {
     Insert(item);
   }
 }
 
-template <typename Key, typename T>
-auto Map<Key, T>::Insert(const ValueType& value) ->
-    std::pair<typename Map<Key, T>::Iterator, bool> {
+template <typename Key, typename T, typename Compare, typename Allocator>
+auto Map<Key, T, Compare, Allocator>::Insert(const ValueType& value) ->
+    std::pair<typename Map<Key, T, Compare, Allocator>::Iterator, bool> {
   return Insert(value.first, value.second);
 }
 
-template <typename Key, typename T>
-auto Map<Key, T>::Insert(const Key& key, const T& obj) ->
-    std::pair<typename Map<Key, T>::Iterator, bool> {
-  auto iter {Find(key)};
-  if (iter == this->end()) {
-    iter = BinarySearchTree<ValueType>::Insert({key, obj});
-    return {iter, true};
-  }
-  return  {iter, false};
+template <typename Key, typename T, typename Compare, typename Allocator>
+auto Map<Key, T, Compare, Allocator>::Insert(const Key& key, const T& obj) ->
+    std::pair<typename Map<Key, T, Compare, Allocator>::Iterator, bool> {
+  return TryEmplace(key, obj);
 }
 
-template <typename Key, typename T>
-auto Map<Key, T>::InsertOrAssign(const Key& key, const T& obj) ->
-    std::pair<typename Map<Key, T>::Iterator, bool> {
-  auto returnable_pair {Insert(key, obj)};
+template <typename Key, typename T, typename Compare, typename Allocator>
+auto Map<Key, T, Compare, Allocator>::Insert(
+    Iterator hint, const ValueType& value) ->
+    typename Map<Key, T, Compare, Allocator>::Iterator {
+  return EmplaceHint(hint, value);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+template <typename... Args>
+auto Map<Key, T, Compare, Allocator>::EmplaceHint(
+    Iterator hint, Args&&... args) ->
+    typename Map<Key, T, Compare, Allocator>::Iterator {
+  auto* node {this->pool_.New(std::uintptr_t {}, nullptr, nullptr,
+                              ValueType(std::forward<Args>(args)...))};
+  return this->InsertNodeWithHint(hint, node, true);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+auto Map<Key, T, Compare, Allocator>::InsertOrAssign(
+    const Key& key, const T& obj) ->
+    std::pair<typename Map<Key, T, Compare, Allocator>::Iterator, bool> {
+  auto returnable_pair {TryEmplace(key, obj)};
   if (returnable_pair.second == false) {
-    returnable_pair.first.node_->value.second = obj;
+    this->ToNode(returnable_pair.first.node_)->value.second = obj;
   }
   return returnable_pair;
 }
 
-template <typename Key, typename T>
-auto Map<Key, T>::Find(const Key& key) const ->
-    typename Map<Key, T>::Iterator {
-  typename BinarySearchTree<ValueType>::Node* node {this->root_};
-  while (node != nullptr && node->value.first != key) {
-    if (key < node->value.first) {
-      node = node->left_child;
-    } else {
-      node = node->right_child;
-    }
+template <typename Key, typename T, typename Compare, typename Allocator>
+template <typename... Args>
+auto Map<Key, T, Compare, Allocator>::TryEmplace(
+    const Key& key, Args&&... args) ->
+    std::pair<typename Map<Key, T, Compare, Allocator>::Iterator, bool> {
+  auto position {this->FindInsertPosition(key, true)};
+  if (position.match != nullptr) {
+    return {Iterator(position.match), false};
   }
-  return Iterator(this, node);
+  auto* node {this->pool_.New(
+      std::uintptr_t {}, nullptr, nullptr,
+      ValueType(std::piecewise_construct, std::forward_as_tuple(key),
+                std::forward_as_tuple(std::forward<Args>(args)...)))};
+  this->LinkNode(node, position);
+  return {Iterator(node), true};
 }
 
-template <typename Key, typename T>
-void Map<Key, T>::Merge(Map& other) {  // NOLINT(runtime/references)
-  if (this == &other) {
-    return;
-  }
-  for (auto iter {other.begin()}; iter != other.end(); ) {
-    if (!Contains((*iter).first)) {
-      this->MoveNodeFromOtherTree(iter++, other);
-    } else {
-      ++iter;
-    }
-  }
+template <typename Key, typename T, typename Compare, typename Allocator>
+auto Map<Key, T, Compare, Allocator>::Find(const Key& key) const ->
+    typename Map<Key, T, Compare, Allocator>::Iterator {
+  return this->MakeIterator(this->FindNode(key));
 }
 
-template <typename Key, typename T>
-T& Map<Key, T>::At(const Key& key) {
-  auto iter {Find(key)};
-  if (iter == this->end()) {
-    throw std::out_of_range("There is no key");
+template <typename Key, typename T, typename Compare, typename Allocator>
+auto Map<Key, T, Compare, Allocator>::Erase(const Key& key) ->
+    typename Map<Key, T, Compare, Allocator>::SizeType {
+  auto* node {this->FindNode(key)};
+  if (node == nullptr) {
+    return 0;
   }
-  return iter.node_->value.second;
+  Base::Erase(Iterator(node));
+  return 1;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+template <typename InputIt>
+void Map<Key, T, Compare, Allocator>::AssignSorted(
+    InputIt first, InputIt last) {
+  this->AssignRange(first, last, true);
 }
 
-template <typename Key, typename T>
-const T& Map<Key, T>::At(const Key& key) const {
-  auto iter {Find(key)};
-  if (iter == this->end()) {
+template <typename Key, typename T, typename Compare, typename Allocator>
+void Map<Key, T, Compare, Allocator>::Merge(
+    Map& other) {  // NOLINT(runtime/references)
+  this->MergeFrom(other, [](auto*, auto*) { return false; });
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+Map<Key, T, Compare, Allocator>
+Map<Key, T, Compare, Allocator>::Split(const Key& key) {
+  Map rest(this->GetAllocator());
+  this->SplitInto(key, &rest);
+  return rest;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+Map<Key, T, Compare, Allocator>
+Map<Key, T, Compare, Allocator>::Union(const Map& other) const {
+  Map result(this->GetAllocator());
+  result.AssignMerged(*this, other, Base::SetOperation::kUnion);
+  return result;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+Map<Key, T, Compare, Allocator> Map<Key, T, Compare, Allocator>::Intersection(
+    const Map& other) const {
+  Map result(this->GetAllocator());
+  result.AssignMerged(*this, other, Base::SetOperation::kIntersection);
+  return result;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+Map<Key, T, Compare, Allocator> Map<Key, T, Compare, Allocator>::Difference(
+    const Map& other) const {
+  Map result(this->GetAllocator());
+  result.AssignMerged(*this, other, Base::SetOperation::kDifference);
+  return result;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+Map<Key, T, Compare, Allocator>
+Map<Key, T, Compare, Allocator>::SymmetricDifference(const Map& other) const {
+  Map result(this->GetAllocator());
+  result.AssignMerged(*this, other, Base::SetOperation::kSymmetricDifference);
+  return result;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+void Map<Key, T, Compare, Allocator>::Join(
+    Map& other) {  // NOLINT(runtime/references)
+  this->JoinWith(other, true);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator>
+template <typename K>
+auto Map<Key, T, Compare, Allocator>::FindOrThrow(const K& key) const ->
+    typename Map<Key, T, Compare, Allocator>::Node* {
+  auto* node {this->FindNode(key)};
+  if (node == nullptr) {
     throw std::out_of_range("There is no key");
   }
-  return iter.node_->value.second;
+  return node;
 }
 
-template <typename Key, typename T>
-T& Map<Key, T>::operator[](const Key& key) {
-  auto iter {Find(key)};
-  if (iter == this->end()) {
-    iter = BinarySearchTree<ValueType>::Insert({key, T{}});
-  }
-  return iter.node_->value.second;
+template <typename Key, typename T, typename Compare, typename Allocator>
+T& Map<Key, T, Compare, Allocator>::operator[](const Key& key) {
+  return this->ToNode(TryEmplace(key).first.node_)->value.second;
 }
 
-template <typename Key, typename T>
+template <typename Key, typename T, typename Compare, typename Allocator>
 template <typename...  Args>
-auto s21::Map<Key, T>::Emplace(Args&&... args) ->
-    s21::Vector<std::pair<typename s21::Map<Key, T>::Iterator, bool>> {
+auto s21::Map<Key, T, Compare, Allocator>::Emplace(Args&&... args) ->
+    s21::Vector<std::pair<Iterator, bool>> {
   s21::Vector<std::pair<Iterator, bool>> returnable_vector{};
   const ValueType args_data[sizeof...(args)] {args...};
   for (SizeType i {0}; i < sizeof...(args); ++i) {
@@ -139,5 +278,14 @@ auto s21::Map<Key, T>::Emplace(Args&&... args) ->
   return returnable_vector;
 }
 
+namespace pmr {
+
+template <typename Key, typename T, typename Compare = std::less<Key>>
+using Map =
+    s21::Map<Key, T, Compare,
+             std::pmr::polymorphic_allocator<std::pair<const Key, T>>>;
+
+}  // namespace pmr
+
 }  // namespace s21
 #endif  // SRC_S21_MAP_H_
@@ -1,98 +1,551 @@
 #ifndef SRC_S21_MULTISET_H_
 #define SRC_S21_MULTISET_H_
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <utility>
 
 #include "binary_search_tree.h"
 #include "s21_vector.h"
 
 namespace s21 {
 
+// One distinct multiset value together with the number of its occurrences.
 template <typename T>
-class Multiset : public BinarySearchTree<T> {
+struct MultisetEntry {
+  T value{};
+  std::size_t count{};
+};
+
+template <typename T>
+struct TreeValueWeight<MultisetEntry<T>> {
+  static std::size_t Of(const MultisetEntry<T>& entry) { return entry.count; }
+};
+
+template <typename T, typename Compare>
+struct MultisetEntryCompare {
+  using EntryType = MultisetEntry<T>;
+  bool operator()(const EntryType& lhs, const EntryType& rhs) const {
+    return key_compare(lhs.value, rhs.value);
+  }
+  template <typename K>
+  bool operator()(const EntryType& lhs, const K& rhs) const {
+    return key_compare(lhs.value, rhs);
+  }
+  template <typename K>
+  bool operator()(const K& lhs, const EntryType& rhs) const {
+    return key_compare(lhs, rhs.value);
+  }
+  Compare key_compare{};
+};
+
+// Keeps every distinct value once in a tree node with its repeat count, so
+// the tree grows with the number of distinct values and iterators step
+// through the occurrences of a node before moving on. Erase(pos) returns the
+// iterator that followed pos; iterators to the earlier occurrences of the
+// erased value are invalidated, those to later ones stay valid.
+template <typename T, typename Compare = std::less<T>,
+          typename Allocator = std::allocator<T>>
+class Multiset
+    : private BinarySearchTree<
+          MultisetEntry<T>, MultisetEntryCompare<T, Compare>,
+          typename std::allocator_traits<Allocator>::template rebind_alloc<
+              MultisetEntry<T>>> {
+  using EntryAllocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<MultisetEntry<T>>;
+  using EntryVector = Vector<MultisetEntry<T>, EntryAllocator>;
+  using Base = BinarySearchTree<MultisetEntry<T>,
+                                MultisetEntryCompare<T, Compare>,
+                                EntryAllocator>;
+  using Node = typename Base::Node;
+  using TreeIterator = typename Base::Iterator;
+
  public:
   using KeyType = T;
   using ValueType = T;
   using Reference = ValueType&;
   using ConstReference = const ValueType&;
-  using Iterator = typename BinarySearchTree<ValueType>::Iterator;
-  using ConstIterator = typename BinarySearchTree<ValueType>::ConstIterator;
-  using SizeType = typename BinarySearchTree<ValueType>::SizeType;
-  explicit Multiset(std::initializer_list<T> const& items);
+  class MultisetIterator;
+  using Iterator = MultisetIterator;
+  using ConstIterator = MultisetIterator;
+  using ReverseIterator = std::reverse_iterator<Iterator>;
+  using SizeType = typename Base::SizeType;
+  using AllocatorType = Allocator;
+  explicit Multiset(const Allocator& allocator)
+      : Base(EntryAllocator(allocator)) {}
+  explicit Multiset(std::initializer_list<T> const& items,
+                    const Allocator& allocator = Allocator());
+  template <typename InputIt>
+  Multiset(InputIt first, InputIt last,
+           const Allocator& allocator = Allocator())
+      : Base(EntryAllocator(allocator)) {
+    AssignSorted(first, last);
+  }
+  Allocator GetAllocator() const { return Allocator(Base::GetAllocator()); }
+  Iterator begin() const { return FirstOccurrence(Base::begin()); }
+  Iterator end() const { return Iterator(Base::end(), 0); }
+  ReverseIterator rbegin() const { return ReverseIterator(end()); }
+  ReverseIterator rend() const { return ReverseIterator(begin()); }
+  Iterator Insert(const T& value);
+  Iterator Insert(Iterator hint, const T& value) {
+    return EmplaceHint(hint, value);
+  }
+  template <typename... Args>
+  Iterator EmplaceHint(Iterator hint, Args&&... args);
+  Iterator Erase(Iterator pos);
+  Iterator Erase(Iterator first, Iterator last);
+  SizeType Erase(const T& key);
+  template <typename Predicate>
+  SizeType EraseIf(Predicate pred);
+  void Swap(Multiset& other) {  // NOLINT(runtime/references)
+    Base::Swap(other);
+  }
   void Merge(Multiset& other);  // NOLINT(runtime/references)
-  SizeType Count(const T& key) const;
-  std::pair<Iterator, Iterator> EqualRange(const T& key) const;
-  Iterator LowerBound(const T& key) const;
-  Iterator UpperBound(const T& key) const;
+  Multiset Union(const Multiset& other) const;
+  Multiset Intersection(const Multiset& other) const;
+  Multiset Difference(const Multiset& other) const;
+  Multiset SymmetricDifference(const Multiset& other) const;
+  template <typename InputIt>
+  void AssignSorted(InputIt first, InputIt last);
+  using Base::Clear;
+  bool Empty() const { return this->root_ == nullptr; }
+  SizeType Size() const { return Base::SubtreeSize(this->root_); }
+  using Base::MaxSize;
+
+  Iterator Find(const T& key) const { return FindOf(key); }
+  bool Contains(const T& key) const { return this->FindNode(key) != nullptr; }
+  SizeType Count(const T& key) const { return CountOf(key); }
+  std::pair<Iterator, Iterator> EqualRange(const T& key) const {
+    return {LowerBound(key), UpperBound(key)};
+  }
+  Iterator LowerBound(const T& key) const {
+    return FirstOccurrence(this->MakeIterator(this->LowerBoundNode(key)));
+  }
+  Iterator UpperBound(const T& key) const {
+    return FirstOccurrence(this->MakeIterator(this->UpperBoundNode(key)));
+  }
+  SizeType Rank(const T& key) const { return this->RankOf(key); }
+  SizeType CountRange(const T& low, const T& high) const {
+    return this->CountRangeOf(low, high);
+  }
+  Iterator Select(SizeType index) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  Iterator Find(const K& key) const { return FindOf(key); }
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool Contains(const K& key) const { return this->FindNode(key) != nullptr; }
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  SizeType Count(const K& key) const { return CountOf(key); }
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<Iterator, Iterator> EqualRange(const K& key) const {
+    return {LowerBound(key), UpperBound(key)};
+  }
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  Iterator LowerBound(const K& key) const {
+    return FirstOccurrence(this->MakeIterator(this->LowerBoundNode(key)));
+  }
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  Iterator UpperBound(const K& key) const {
+    return FirstOccurrence(this->MakeIterator(this->UpperBoundNode(key)));
+  }
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  SizeType Rank(const K& key) const { return this->RankOf(key); }
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  SizeType CountRange(const K& low, const K& high) const {
+    return this->CountRangeOf(low, high);
+  }
 
   template <typename... Args>
   s21::Vector<Iterator> Emplace(Args&&... args);
+
+ private:
+  static Iterator FirstOccurrence(TreeIterator position) {
+    return Iterator(position, position.node_->IsHeader()
+                                  ? 0
+                                  : (*position).count - 1);
+  }
+  template <typename K>
+  Iterator FindOf(const K& key) const;
+  template <typename K>
+  SizeType CountOf(const K& key) const;
+  Iterator InsertAt(T&& value,
+                    const typename Base::InsertPosition& position);
+  void AddOccurrences(Node* node, SizeType count);
+  Multiset Combine(const Multiset& other,
+                   typename Base::SetOperation operation) const;
 };
 
-template <typename T>
-Multiset<T>::Multiset(std::initializer_list<T> const& items) {
+// Points at one occurrence of a distinct value: the tree node plus the number
+// of its occurrences that follow this one. Counting from the back keeps an
+// iterator valid while occurrences before it are erased.
+template <typename T, typename Compare, typename Allocator>
+class Multiset<T, Compare, Allocator>::MultisetIterator {
+ public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const T*;
+  using reference = const T&;
+  MultisetIterator() {}
+  MultisetIterator(TreeIterator position, SizeType remaining)
+      : position_ {position}, remaining_ {remaining} {}
+  const T& operator*() const { return (*position_).value; }
+  const T* operator->() const { return &**this; }
+  MultisetIterator& operator++() {
+    if (remaining_ > 0) {
+      --remaining_;
+    } else {
+      ++position_;
+      remaining_ = position_.node_->IsHeader() ? 0 : (*position_).count - 1;
+    }
+    return *this;
+  }
+  MultisetIterator& operator--() {
+    if (!position_.node_->IsHeader() &&
+        remaining_ + 1 < (*position_).count) {
+      ++remaining_;
+    } else {
+      --position_;
+      remaining_ = 0;
+    }
+    return *this;
+  }
+  MultisetIterator operator++(int) {
+    MultisetIterator tmp {*this};
+    ++(*this);
+    return tmp;
+  }
+  MultisetIterator operator--(int) {
+    MultisetIterator tmp {*this};
+    --(*this);
+    return tmp;
+  }
+  bool operator==(const MultisetIterator& other) const {
+    return position_ == other.position_ && remaining_ == other.remaining_;
+  }
+  bool operator!=(const MultisetIterator& other) const {
+    return !(*this == other);
+  }
+
+  TreeIterator position_{};
+  SizeType remaining_{};
+};
+
+template <typename T, typename Compare, typename Allocator>
+Multiset<T, Compare, Allocator>::Multiset(
+    std::initializer_list<T> const& items, const Allocator& allocator)
+    : Base(EntryAllocator(allocator)) {
   for (auto item : items) {
-    this->Insert(item);
+    Insert(item);
   }
 }
 
-template <typename T>
-void Multiset<T>::Merge(Multiset& other) {  // NOLINT(runtime/references)
-  if (this == &other) {
-    return;
+template <typename T, typename Compare, typename Allocator>
+typename Multiset<T, Compare, Allocator>::Iterator
+Multiset<T, Compare, Allocator>::Insert(const T& value) {
+  return InsertAt(T(value), this->FindInsertPosition(value, true));
+}
+
+template <typename T, typename Compare, typename Allocator>
+template <typename... Args>
+typename Multiset<T, Compare, Allocator>::Iterator
+Multiset<T, Compare, Allocator>::EmplaceHint(Iterator hint, Args&&... args) {
+  T value(std::forward<Args>(args)...);
+  typename Base::InsertPosition position{};
+  if (!this->FindHintPosition(Base::ToNode(hint.position_.node_), value,
+                              true, &position)) {
+    position = this->FindInsertPosition(value, true);
   }
-  for (auto iter {other.begin()}; iter != other.end(); ) {
-    this->MoveNodeFromOtherTree(iter++, other);
+  Iterator inserted {InsertAt(std::move(value), position)};
+  // an occurrence added to the hint's own value lands right before the hint
+  if (inserted.position_ == hint.position_) {
+    inserted.remaining_ = hint.remaining_ + 1;
   }
+  return inserted;
 }
 
-template <typename T>
-typename Multiset<T>::SizeType Multiset<T>::Count(const T& key) const {
-  auto range_pair {EqualRange(key)};
-  SizeType counter{0};
-  for (; range_pair.first != range_pair.second; ++range_pair.first) {
-    ++counter;
+template <typename T, typename Compare, typename Allocator>
+typename Multiset<T, Compare, Allocator>::Iterator
+Multiset<T, Compare, Allocator>::Erase(Iterator pos) {
+  Node* node {Base::ToNode(pos.position_.node_)};
+  if (node == nullptr) {
+    return pos;
   }
-  return counter;
+  Iterator next {std::next(pos)};
+  if (node->value.count > 1) {
+    --node->value.count;
+    this->ShrinkPath(node, 1);
+  } else {
+    Base::Erase(pos.position_);
+  }
+  return next;
 }
 
-template <typename T>
-auto Multiset<T>::EqualRange(const T& key) const ->
-    std::pair<typename Multiset<T>::Iterator, typename Multiset<T>::Iterator> {
-  auto first_iter {this->Find(key)};
-  auto second_iter {first_iter};
-  if (first_iter != this->end()) {
-    while (second_iter != this->end()) {
-      if (*second_iter != key) {
-        break;
+template <typename T, typename Compare, typename Allocator>
+typename Multiset<T, Compare, Allocator>::Iterator
+Multiset<T, Compare, Allocator>::Erase(Iterator first, Iterator last) {
+  if (first == last) {
+    return last;
+  }
+  Node* first_node {Base::ToNode(first.position_.node_)};
+  Node* last_node {Base::ToNode(last.position_.node_)};
+  if (first_node == last_node) {
+    SizeType removed {first.remaining_ - last.remaining_};
+    first_node->value.count -= removed;
+    this->ShrinkPath(first_node, removed);
+    return last;
+  }
+  // occurrences before first and from last on stay in their nodes, every
+  // node in between goes as a whole
+  if (first.remaining_ + 1 < first_node->value.count) {
+    SizeType removed {first.remaining_ + 1};
+    first_node->value.count -= removed;
+    this->ShrinkPath(first_node, removed);
+    first_node = this->Successor(first_node);
+  }
+  if (last_node != nullptr && last.remaining_ + 1 < last_node->value.count) {
+    SizeType removed {last_node->value.count - last.remaining_ - 1};
+    last_node->value.count -= removed;
+    this->ShrinkPath(last_node, removed);
+  }
+  this->EraseRange(first_node, last_node);
+  return last;
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename Multiset<T, Compare, Allocator>::SizeType
+Multiset<T, Compare, Allocator>::Erase(const T& key) {
+  Node* node {this->FindNode(key)};
+  if (node == nullptr) {
+    return 0;
+  }
+  SizeType count {node->value.count};
+  Base::Erase(TreeIterator(node));
+  return count;
+}
+
+template <typename T, typename Compare, typename Allocator>
+template <typename Predicate>
+typename Multiset<T, Compare, Allocator>::SizeType
+Multiset<T, Compare, Allocator>::EraseIf(Predicate pred) {
+  SizeType erased {0};
+  Base::EraseIf([&pred, &erased](const MultisetEntry<T>& entry) {
+    if (!pred(entry.value)) {
+      return false;
+    }
+    erased += entry.count;
+    return true;
+  });
+  return erased;
+}
+
+template <typename T, typename Compare, typename Allocator>
+void Multiset<T, Compare, Allocator>::Merge(
+    Multiset& other) {  // NOLINT(runtime/references)
+  this->MergeFrom(other, [](Node* node, Node* other_node) {
+    node->value.count += other_node->value.count;
+    return true;
+  });
+}
+
+template <typename T, typename Compare, typename Allocator>
+Multiset<T, Compare, Allocator> Multiset<T, Compare, Allocator>::Union(
+    const Multiset& other) const {
+  return Combine(other, Base::SetOperation::kUnion);
+}
+
+template <typename T, typename Compare, typename Allocator>
+Multiset<T, Compare, Allocator> Multiset<T, Compare, Allocator>::Intersection(
+    const Multiset& other) const {
+  return Combine(other, Base::SetOperation::kIntersection);
+}
+
+template <typename T, typename Compare, typename Allocator>
+Multiset<T, Compare, Allocator> Multiset<T, Compare, Allocator>::Difference(
+    const Multiset& other) const {
+  return Combine(other, Base::SetOperation::kDifference);
+}
+
+template <typename T, typename Compare, typename Allocator>
+Multiset<T, Compare, Allocator>
+Multiset<T, Compare, Allocator>::SymmetricDifference(
+     const Multiset& other) const {
+  return Combine(other, Base::SetOperation::kSymmetricDifference);
+}
+
+template <typename T, typename Compare, typename Allocator>
+template <typename InputIt>
+void Multiset<T, Compare, Allocator>::AssignSorted(
+    InputIt first, InputIt last) {
+  // equal neighbours collapse into one entry before the tree is built
+  EntryVector entries(Base::GetAllocator());
+  bool sorted {true};
+  for (; first != last; ++first) {
+    if (!entries.Empty() && !this->compare_(entries.Back(), *first)) {
+      if (!this->compare_(*first, entries.Back())) {
+        ++entries.Back().count;
+        continue;
       }
-      ++second_iter;
+      sorted = false;
+    }
+    entries.PushBack(MultisetEntry<T> {*first, 1});
+  }
+  if (sorted) {
+    this->AssignRange(entries.begin(), entries.end(), true);
+    return;
+  }
+  Clear();
+  for (const auto& entry : entries) {
+    auto position {this->FindInsertPosition(entry.value, true)};
+    if (position.match != nullptr) {
+      AddOccurrences(position.match, entry.count);
+    } else {
+      this->LinkNode(
+          this->pool_.New(std::uintptr_t {}, nullptr, nullptr, entry),
+          position);
     }
   }
-  return {first_iter, second_iter};
 }
 
-template <typename T>
-typename Multiset<T>::Iterator Multiset<T>::LowerBound(const T& key) const {
-  return EqualRange(key).first;
+template <typename T, typename Compare, typename Allocator>
+typename Multiset<T, Compare, Allocator>::Iterator
+Multiset<T, Compare, Allocator>::Select(SizeType index) const {
+  Node* node {this->SelectNode(&index)};
+  return Iterator(this->MakeIterator(node),
+                  node == nullptr ? 0 : node->value.count - 1 - index);
 }
 
-template <typename T>
-typename Multiset<T>::Iterator Multiset<T>::UpperBound(const T& key) const {
-  return EqualRange(key).second;
+template <typename T, typename Compare, typename Allocator>
+template <typename K>
+typename Multiset<T, Compare, Allocator>::Iterator
+Multiset<T, Compare, Allocator>::FindOf(const K& key) const {
+  return FirstOccurrence(this->MakeIterator(this->FindNode(key)));
 }
 
-template <typename T>
+template <typename T, typename Compare, typename Allocator>
+template <typename K>
+typename Multiset<T, Compare, Allocator>::SizeType
+Multiset<T, Compare, Allocator>::CountOf(const K& key) const {
+  Node* node {this->FindNode(key)};
+  return node == nullptr ? 0 : node->value.count;
+}
+
+template <typename T, typename Compare, typename Allocator>
+typename Multiset<T, Compare, Allocator>::Iterator
+Multiset<T, Compare, Allocator>::InsertAt(
+     T&& value, const typename Base::InsertPosition& position) {
+  // a new occurrence of a known value goes after its equals
+  if (position.match != nullptr) {
+    AddOccurrences(position.match, 1);
+    return Iterator(TreeIterator(position.match), 0);
+  }
+  Node* node {this->pool_.New(std::uintptr_t {}, nullptr, nullptr,
+                              MultisetEntry<T> {std::move(value), 1})};
+  this->LinkNode(node, position);
+  return Iterator(TreeIterator(node), 0);
+}
+
+template <typename T, typename Compare, typename Allocator>
+Multiset<T, Compare, Allocator> Multiset<T, Compare, Allocator>::Combine(
+    const Multiset& other, typename Base::SetOperation operation) const {
+  // works on occurrence counts like std::set_union and friends: the larger
+  // count for a union, the smaller for an intersection, the excess of this
+  // one for a difference and the absolute difference for the last one
+  using Operation = typename Base::SetOperation;
+  EntryVector entries(Base::GetAllocator());
+  entries.Reserve(this->tree_size_ + other.tree_size_);
+  auto append {[&entries](const T& value, SizeType count) {
+    if (count != 0) {
+      entries.PushBack(MultisetEntry<T> {value, count});
+    }
+  }};
+  bool keep_left {operation != Operation::kIntersection};
+  bool keep_right {operation == Operation::kUnion ||
+                   operation == Operation::kSymmetricDifference};
+  auto left {Base::begin()};
+  auto right {other.Base::begin()};
+  while (left != Base::end() && right != other.Base::end()) {
+    const MultisetEntry<T>& mine {*left};
+    const MultisetEntry<T>& theirs {*right};
+    if (this->compare_(mine, theirs)) {
+      append(mine.value, keep_left ? mine.count : 0);
+      ++left;
+    } else if (this->compare_(theirs, mine)) {
+      append(theirs.value, keep_right ? theirs.count : 0);
+      ++right;
+    } else {
+      SizeType low {std::min(mine.count, theirs.count)};
+      SizeType high {std::max(mine.count, theirs.count)};
+      switch (operation) {
+        case Operation::kUnion:
+          append(mine.value, high);
+          break;
+        case Operation::kIntersection:
+          append(mine.value, low);
+          break;
+        case Operation::kDifference:
+          append(mine.value, mine.count - low);
+          break;
+        case Operation::kSymmetricDifference:
+          append(mine.value, high - low);
+          break;
+      }
+      ++left;
+      ++right;
+    }
+  }
+  for (; keep_left && left != Base::end(); ++left) {
+    append((*left).value, (*left).count);
+  }
+  for (; keep_right && right != other.Base::end(); ++right) {
+    append((*right).value, (*right).count);
+  }
+  Multiset result(GetAllocator());
+  result.compare_ = this->compare_;
+  result.AssignRange(entries.begin(), entries.end(), true);
+  return result;
+}
+
+template <typename T, typename Compare, typename Allocator>
+void Multiset<T, Compare, Allocator>::AddOccurrences(
+    Node* node, SizeType count) {
+  node->value.count += count;
+  this->GrowPath(node, count);
+}
+
+template <typename T, typename Compare, typename Allocator>
 template <typename... Args>
-Vector<typename Multiset<T>::Iterator> Multiset<T>::Emplace(Args&&... args) {
+auto Multiset<T, Compare, Allocator>::Emplace(Args&&... args)
+    -> Vector<typename Multiset<T, Compare, Allocator>::Iterator> {
   s21::Vector<Iterator> returnable_vector;
   const ValueType args_data[sizeof...(args)] {args...};
   for (SizeType i {0}; i < sizeof...(args); ++i) {
-    returnable_vector.PushBack(this->Insert(args_data[i]));
+    returnable_vector.PushBack(Insert(args_data[i]));
   }
   return returnable_vector;
 }
 
+namespace pmr {
+
+template <typename T, typename Compare = std::less<T>>
+using Multiset =
+    s21::Multiset<T, Compare, std::pmr::polymorphic_allocator<T>>;
+
+}  // namespace pmr
+
 }  // namespace s21
 
 #endif  // SRC_S21_MULTISET_H_
@@ -0,0 +1,57 @@
+#ifndef SRC_S21_PERSISTENT_MAP_H_
+#define SRC_S21_PERSISTENT_MAP_H_
+
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "map_value_compare.h"
+#include "persistent_tree.h"
+
+namespace s21 {
+
+// Values are shared between versions, so they can only be read through a
+// map: At has no mutable overload and there is no operator[]. Updates go
+// through Insert, InsertOrAssign and Erase, which change this version only.
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class PersistentMap
+    : public PersistentTree<std::pair<const Key, T>,
+                            MapValueCompare<Key, T, Compare>> {
+  using Base = PersistentTree<std::pair<const Key, T>,
+                              MapValueCompare<Key, T, Compare>>;
+
+ public:
+  using KeyType = Key;
+  using MappedType = T;
+  using ValueType = std::pair<const Key, T>;
+  using Reference = const ValueType&;
+  using ConstReference = const ValueType&;
+  using Iterator = typename Base::Iterator;
+  using ConstIterator = typename Base::ConstIterator;
+  using SizeType = typename Base::SizeType;
+  PersistentMap() {}
+  explicit PersistentMap(std::initializer_list<ValueType> items)
+      : Base(items) {}
+  using Base::Insert;
+  std::pair<Iterator, bool> Insert(const Key& key, const T& obj) {
+    return Insert(ValueType {key, obj});
+  }
+  std::pair<Iterator, bool> InsertOrAssign(const Key& key, const T& obj) {
+    return this->InsertValue(ValueType {key, obj}, true);
+  }
+  const T& At(const Key& key) const;
+};
+
+template <typename Key, typename T, typename Compare>
+const T& PersistentMap<Key, T, Compare>::At(const Key& key) const {
+  auto iter {this->Find(key)};
+  if (iter == this->end()) {
+    throw std::out_of_range("There is no key");
+  }
+  return iter->second;
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_PERSISTENT_MAP_H_
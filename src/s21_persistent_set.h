@@ -0,0 +1,29 @@
+#ifndef SRC_S21_PERSISTENT_SET_H_
+#define SRC_S21_PERSISTENT_SET_H_
+
+#include <functional>
+#include <initializer_list>
+
+#include "persistent_tree.h"
+
+namespace s21 {
+
+template <typename T, typename Compare = std::less<T>>
+class PersistentSet : public PersistentTree<T, Compare> {
+  using Base = PersistentTree<T, Compare>;
+
+ public:
+  using KeyType = T;
+  using ValueType = T;
+  using Reference = const ValueType&;
+  using ConstReference = const ValueType&;
+  using Iterator = typename Base::Iterator;
+  using ConstIterator = typename Base::ConstIterator;
+  using SizeType = typename Base::SizeType;
+  PersistentSet() {}
+  explicit PersistentSet(std::initializer_list<T> items) : Base(items) {}
+};
+
+}  // namespace s21
+
+#endif  // SRC_S21_PERSISTENT_SET_H_
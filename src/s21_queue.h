@@ -3,26 +3,33 @@
 
 #include <cstddef>
 #include <initializer_list>
+#include <memory>
+#include <memory_resource>
 #include <utility>
 
 #include "s21_list.h"
 
 namespace s21 {
 
-template <typename T>
+template <typename T, typename Allocator = std::allocator<T>>
 class Queue {
  public:
   using ValueType = T;
   using Reference = T&;
   using ConstReference = const T&;
   using SizeType = std::size_t;
+  using AllocatorType = Allocator;
   Queue() {}
-  explicit Queue(std::initializer_list<T> const& items) : list_{items} {}
-  Queue(const Queue& other) { *this = other; }
-  Queue(Queue&& other) { *this = std::move(other); }
+  explicit Queue(const Allocator& allocator) : list_(allocator) {}
+  explicit Queue(std::initializer_list<T> const& items,
+                 const Allocator& allocator = Allocator())
+      : list_(items, allocator) {}
+  Queue(const Queue& other) : list_{other.list_} {}
+  Queue(Queue&& other) : list_{std::move(other.list_)} {}
   Queue& operator=(const Queue& other);
   Queue& operator=(Queue&& other);
   ~Queue() {}
+  Allocator GetAllocator() const { return list_.GetAllocator(); }
   T& Front() { return list_.Front(); }
   T& Back() { return list_.Back(); }
   const T& Front() const { return list_.Front(); }
@@ -39,11 +46,12 @@ class Queue {
   }
 
  private:
-  List<T> list_{};
+  List<T, Allocator> list_{};
 };
 
-template <typename T>
-typename Queue<T>::Queue& Queue<T>::operator=(const Queue& other) {
+template <typename T, typename Allocator>
+typename Queue<T, Allocator>::Queue& Queue<T, Allocator>::operator=(
+    const Queue& other) {
   if (this == &other) {
     return *this;
   }
@@ -51,15 +59,23 @@ typename Queue<T>::Queue& Queue<T>::operator=(const Queue& other) {
   return *this;
 }
 
-template <typename T>
-typename Queue<T>::Queue& Queue<T>::operator=(Queue&& other) {
+template <typename T, typename Allocator>
+typename Queue<T, Allocator>::Queue& Queue<T, Allocator>::operator=(
+    Queue&& other) {
   if (this == &other) {
     return *this;
   }
-  list_.Swap(other.list_);
+  list_ = std::move(other.list_);
   return *this;
 }
 
+namespace pmr {
+
+template <typename T>
+using Queue = s21::Queue<T, std::pmr::polymorphic_allocator<T>>;
+
+}  // namespace pmr
+
 }  // namespace s21
 
 #endif  // SRC_S21_QUEUE_H_
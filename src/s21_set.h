@@ -1,66 +1,154 @@
 #ifndef SRC_S21_SET_H_
 #define SRC_S21_SET_H_
 
+#include <cstdint>
+#include <functional>
 #include <initializer_list>
+#include <memory>
+#include <memory_resource>
 
 #include "binary_search_tree.h"
 #include "s21_vector.h"
 
 namespace s21 {
 
-template <typename T>
-class Set : public BinarySearchTree<T> {
+template <typename T, typename Compare = std::less<T>,
+          typename Allocator = std::allocator<T>>
+class Set : public BinarySearchTree<T, Compare, Allocator> {
+  using Base = BinarySearchTree<T, Compare, Allocator>;
+
  public:
   using KeyType = T;
   using ValueType = T;
   using Reference = ValueType&;
   using ConstReference = const ValueType&;
-  using Iterator = typename BinarySearchTree<ValueType>::Iterator;
-  using ConstIterator = typename BinarySearchTree<ValueType>::ConstIterator;
-  using SizeType = typename BinarySearchTree<ValueType>::SizeType;
-  explicit Set(std::initializer_list<T> items);
+  using Iterator = typename Base::Iterator;
+  using ConstIterator = typename Base::ConstIterator;
+  using SizeType = typename Base::SizeType;
+  using AllocatorType = Allocator;
+  explicit Set(const Allocator& allocator) : Base(allocator) {}
+  explicit Set(std::initializer_list<T> items,
+               const Allocator& allocator = Allocator());
+  template <typename InputIt>
+  Set(InputIt first, InputIt last, const Allocator& allocator = Allocator())
+      : Base(allocator) {
+    AssignSorted(first, last);
+  }
   std::pair<Iterator, bool> Insert(const T& value);
+  Iterator Insert(Iterator hint, const T& value);
+  template <typename... Args>
+  Iterator EmplaceHint(Iterator hint, Args&&... args);
+  template <typename InputIt>
+  void AssignSorted(InputIt first, InputIt last);
   void Merge(Set& other);  // NOLINT(runtime/references)
+  Set Split(const T& key);
+  Set Union(const Set& other) const;
+  Set Intersection(const Set& other) const;
+  Set Difference(const Set& other) const;
+  Set SymmetricDifference(const Set& other) const;
+  void Join(Set& other);  // NOLINT(runtime/references)
 
   template<typename... Args>
   s21::Vector<std::pair<Iterator, bool>> Emplace(Args&&... args);
 };
 
-template <typename T>
-Set<T>::Set(std::initializer_list<T> items) {
+template <typename T, typename Compare, typename Allocator>
+Set<T, Compare, Allocator>::Set(std::initializer_list<T> items,
+                                const Allocator& allocator)
+    : Base(allocator) {
   for (const auto& item : items) {
     Insert(item);
   }
 }
 
-template <typename T>
-auto Set<T>::Insert(const T& value) ->
-    std::pair<typename Set<T>::Iterator, bool> {
-  auto iter {this->Find(value)};
-  if (iter == this->end()) {
-    return {BinarySearchTree<T>::Insert(value), true};
+template <typename T, typename Compare, typename Allocator>
+auto Set<T, Compare, Allocator>::Insert(const T& value) ->
+    std::pair<typename Set<T, Compare, Allocator>::Iterator, bool> {
+  auto position {this->FindInsertPosition(value, true)};
+  if (position.match != nullptr) {
+    return {Iterator(position.match), false};
   }
-  return {iter, false};
+  auto* node {this->pool_.New(std::uintptr_t {}, nullptr, nullptr, value)};
+  this->LinkNode(node, position);
+  return {Iterator(node), true};
 }
 
-template <typename T>
-void Set<T>::Merge(Set& other) {  // NOLINT(runtime/references)
-  if (this == &other) {
-    return;
-  }
-  for (auto iter {other.begin()}; iter != other.end(); ) {
-    if (!this->Contains(*iter)) {
-      this->MoveNodeFromOtherTree(iter++, other);
-    } else {
-      ++iter;
-    }
-  }
+template <typename T, typename Compare, typename Allocator>
+typename Set<T, Compare, Allocator>::Iterator
+Set<T, Compare, Allocator>::Insert(Iterator hint, const T& value) {
+  return EmplaceHint(hint, value);
+}
+
+template <typename T, typename Compare, typename Allocator>
+template <typename... Args>
+typename Set<T, Compare, Allocator>::Iterator
+Set<T, Compare, Allocator>::EmplaceHint(Iterator hint, Args&&... args) {
+  auto* node {this->pool_.New(std::uintptr_t {}, nullptr, nullptr,
+                              T(std::forward<Args>(args)...))};
+  return this->InsertNodeWithHint(hint, node, true);
+}
+
+template <typename T, typename Compare, typename Allocator>
+template <typename InputIt>
+void Set<T, Compare, Allocator>::AssignSorted(InputIt first, InputIt last) {
+  this->AssignRange(first, last, true);
+}
+
+template <typename T, typename Compare, typename Allocator>
+void Set<T, Compare, Allocator>::Merge(
+    Set& other) {  // NOLINT(runtime/references)
+  this->MergeFrom(other, [](auto*, auto*) { return false; });
+}
+
+template <typename T, typename Compare, typename Allocator>
+Set<T, Compare, Allocator> Set<T, Compare, Allocator>::Split(const T& key) {
+  Set rest(this->GetAllocator());
+  this->SplitInto(key, &rest);
+  return rest;
 }
 
-template <typename T>
+template <typename T, typename Compare, typename Allocator>
+Set<T, Compare, Allocator>
+Set<T, Compare, Allocator>::Union(const Set& other) const {
+  Set result(this->GetAllocator());
+  result.AssignMerged(*this, other, Base::SetOperation::kUnion);
+  return result;
+}
+
+template <typename T, typename Compare, typename Allocator>
+Set<T, Compare, Allocator>
+Set<T, Compare, Allocator>::Intersection(const Set& other) const {
+  Set result(this->GetAllocator());
+  result.AssignMerged(*this, other, Base::SetOperation::kIntersection);
+  return result;
+}
+
+template <typename T, typename Compare, typename Allocator>
+Set<T, Compare, Allocator>
+Set<T, Compare, Allocator>::Difference(const Set& other) const {
+  Set result(this->GetAllocator());
+  result.AssignMerged(*this, other, Base::SetOperation::kDifference);
+  return result;
+}
+
+template <typename T, typename Compare, typename Allocator>
+Set<T, Compare, Allocator>
+Set<T, Compare, Allocator>::SymmetricDifference(const Set& other) const {
+  Set result(this->GetAllocator());
+  result.AssignMerged(*this, other, Base::SetOperation::kSymmetricDifference);
+  return result;
+}
+
+template <typename T, typename Compare, typename Allocator>
+void Set<T, Compare, Allocator>::Join(
+    Set& other) {  // NOLINT(runtime/references)
+  this->JoinWith(other, true);
+}
+
+template <typename T, typename Compare, typename Allocator>
 template <typename... Args>
-Vector<std::pair<typename s21::Set<T>::Iterator, bool>> Set<T>::Emplace(
-    Args&&... args) {
+auto Set<T, Compare, Allocator>::Emplace(Args&&... args)
+    -> Vector<std::pair<typename Set<T, Compare, Allocator>::Iterator, bool>> {
   s21::Vector<std::pair<Iterator, bool>> returnable_vector{};
   const ValueType args_data[sizeof...(args)] {args...};
   for (SizeType i {0}; i < sizeof...(args); ++i) {
@@ -69,6 +157,13 @@ Vector<std::pair<typename s21::Set<T>::Iterator, bool>> Set<T>::Emplace(
   return returnable_vector;
 }
 
+namespace pmr {
+
+template <typename T, typename Compare = std::less<T>>
+using Set = s21::Set<T, Compare, std::pmr::polymorphic_allocator<T>>;
+
+}  // namespace pmr
+
 }  // namespace s21
 
 #endif  // SRC_S21_SET_H_
@@ -0,0 +1,243 @@
+#ifndef SRC_S21_SHARDED_MAP_H_
+#define SRC_S21_SHARDED_MAP_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <utility>
+
+#include "s21_map.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Map safe to use from many threads at once. Keys are hashed to one of a
+// power of two number of shards, each a Map behind its own reader/writer
+// lock, so threads working on different shards never wait for each other
+// and readers of one shard only wait for its writers. Values are returned
+// by copy, since a reference would outlive the lock that guards it.
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          typename Hash = std::hash<Key>>
+class ShardedMap {
+ public:
+  using KeyType = Key;
+  using MappedType = T;
+  using ValueType = std::pair<const Key, T>;
+  using SizeType = std::size_t;
+  explicit ShardedMap(SizeType shard_count = kDefaultShardCount);
+  ShardedMap(const ShardedMap& other) = delete;
+  ShardedMap& operator=(const ShardedMap& other) = delete;
+
+  bool Insert(const Key& key, const T& obj);
+  bool InsertOrAssign(const Key& key, const T& obj);
+  SizeType Erase(const Key& key);
+  std::optional<T> Find(const Key& key) const;
+  bool Contains(const Key& key) const;
+  SizeType InsertMany(const Vector<std::pair<Key, T>>& items);
+  Vector<std::optional<T>> FindMany(const Vector<Key>& keys) const;
+  void Clear();
+  bool Empty() const { return Size() == 0; }
+  SizeType Size() const;
+  SizeType ShardCount() const { return shard_mask_ + 1; }
+
+  static constexpr SizeType kDefaultShardCount {64};
+  // shards sit on separate cache lines so that the lock words of two
+  // shards never share one
+  static constexpr SizeType kCacheLineSize {64};
+
+ private:
+  struct alignas(kCacheLineSize) Shard {
+    mutable std::shared_mutex mutex{};
+    Map<Key, T, Compare> map{};
+  };
+  using ReadLock = std::shared_lock<std::shared_mutex>;
+  using WriteLock = std::unique_lock<std::shared_mutex>;
+  SizeType ShardIndex(const Key& key) const;
+  template <typename Items, typename KeyOf>
+  Vector<SizeType> GroupByShard(const Items& items, KeyOf key_of,
+                                Vector<SizeType>* shard_begin) const;
+  std::unique_ptr<Shard[]> shards_{};
+  SizeType shard_mask_{};
+  unsigned shard_shift_{};
+  Hash hash_{};
+};
+
+template <typename Key, typename T, typename Compare, typename Hash>
+ShardedMap<Key, T, Compare, Hash>::ShardedMap(SizeType shard_count) {
+  SizeType count {1};
+  unsigned bits {0};
+  while (count < shard_count) {
+    count *= 2;
+    ++bits;
+  }
+  shards_.reset(new Shard[count]);
+  shard_mask_ = count - 1;
+  shard_shift_ = 64 - bits;
+}
+
+template <typename Key, typename T, typename Compare, typename Hash>
+bool ShardedMap<Key, T, Compare, Hash>::Insert(const Key& key, const T& obj) {
+  Shard& shard {shards_[ShardIndex(key)]};
+  WriteLock lock {shard.mutex};
+  return shard.map.Insert(key, obj).second;
+}
+
+template <typename Key, typename T, typename Compare, typename Hash>
+bool ShardedMap<Key, T, Compare, Hash>::InsertOrAssign(const Key& key,
+                                                       const T& obj) {
+  Shard& shard {shards_[ShardIndex(key)]};
+  WriteLock lock {shard.mutex};
+  return shard.map.InsertOrAssign(key, obj).second;
+}
+
+template <typename Key, typename T, typename Compare, typename Hash>
+typename ShardedMap<Key, T, Compare, Hash>::SizeType
+ShardedMap<Key, T, Compare, Hash>::Erase(const Key& key) {
+  Shard& shard {shards_[ShardIndex(key)]};
+  WriteLock lock {shard.mutex};
+  return shard.map.Erase(key);
+}
+
+template <typename Key, typename T, typename Compare, typename Hash>
+std::optional<T> ShardedMap<Key, T, Compare, Hash>::Find(
+    const Key& key) const {
+  const Shard& shard {shards_[ShardIndex(key)]};
+  ReadLock lock {shard.mutex};
+  auto iter {shard.map.Find(key)};
+  if (iter == shard.map.end()) {
+    return std::nullopt;
+  }
+  return iter->second;
+}
+
+template <typename Key, typename T, typename Compare, typename Hash>
+bool ShardedMap<Key, T, Compare, Hash>::Contains(const Key& key) const {
+  const Shard& shard {shards_[ShardIndex(key)]};
+  ReadLock lock {shard.mutex};
+  return shard.map.Contains(key);
+}
+
+template <typename Key, typename T, typename Compare, typename Hash>
+typename ShardedMap<Key, T, Compare, Hash>::SizeType
+ShardedMap<Key, T, Compare, Hash>::InsertMany(
+    const Vector<std::pair<Key, T>>& items) {
+  Vector<SizeType> shard_begin{};
+  Vector<SizeType> order {GroupByShard(
+      items, [](const std::pair<Key, T>& item) -> const Key& {
+        return item.first;
+      }, &shard_begin)};
+  SizeType inserted {0};
+  for (SizeType index {0}; index <= shard_mask_; ++index) {
+    if (shard_begin[index] == shard_begin[index + 1]) {
+      continue;
+    }
+    Shard& shard {shards_[index]};
+    WriteLock lock {shard.mutex};
+    for (SizeType i {shard_begin[index]}; i < shard_begin[index + 1]; ++i) {
+      const auto& item {items[order[i]]};
+      inserted += shard.map.Insert(item.first, item.second).second;
+    }
+  }
+  return inserted;
+}
+
+template <typename Key, typename T, typename Compare, typename Hash>
+Vector<std::optional<T>> ShardedMap<Key, T, Compare, Hash>::FindMany(
+    const Vector<Key>& keys) const {
+  // results come back in the order of keys
+  Vector<SizeType> shard_begin{};
+  Vector<SizeType> order {GroupByShard(
+      keys, [](const Key& key) -> const Key& { return key; }, &shard_begin)};
+  Vector<std::optional<T>> found{};
+  found.Reserve(keys.Size());
+  for (SizeType i {0}; i < keys.Size(); ++i) {
+    found.PushBack(std::nullopt);
+  }
+  for (SizeType index {0}; index <= shard_mask_; ++index) {
+    if (shard_begin[index] == shard_begin[index + 1]) {
+      continue;
+    }
+    const Shard& shard {shards_[index]};
+    ReadLock lock {shard.mutex};
+    for (SizeType i {shard_begin[index]}; i < shard_begin[index + 1]; ++i) {
+      auto iter {shard.map.Find(keys[order[i]])};
+      if (iter != shard.map.end()) {
+        found[order[i]] = iter->second;
+      }
+    }
+  }
+  return found;
+}
+
+template <typename Key, typename T, typename Compare, typename Hash>
+void ShardedMap<Key, T, Compare, Hash>::Clear() {
+  for (SizeType index {0}; index <= shard_mask_; ++index) {
+    WriteLock lock {shards_[index].mutex};
+    shards_[index].map.Clear();
+  }
+}
+
+template <typename Key, typename T, typename Compare, typename Hash>
+typename ShardedMap<Key, T, Compare, Hash>::SizeType
+ShardedMap<Key, T, Compare, Hash>::Size() const {
+  // shards are counted one after another, so under concurrent updates the
+  // sum is only a snapshot of each shard at a slightly different moment
+  SizeType size {0};
+  for (SizeType index {0}; index <= shard_mask_; ++index) {
+    ReadLock lock {shards_[index].mutex};
+    size += shards_[index].map.Size();
+  }
+  return size;
+}
+
+template <typename Key, typename T, typename Compare, typename Hash>
+typename ShardedMap<Key, T, Compare, Hash>::SizeType
+ShardedMap<Key, T, Compare, Hash>::ShardIndex(const Key& key) const {
+  // std::hash of an integer is often the integer itself, so the hash is
+  // mixed by a Fibonacci multiplication and the top bits pick the shard
+  if (shard_mask_ == 0) {
+    return 0;
+  }
+  std::uint64_t hash {static_cast<std::uint64_t>(hash_(key))};
+  return static_cast<SizeType>((hash * 0x9E3779B97F4A7C15ull) >>
+                               shard_shift_);
+}
+
+template <typename Key, typename T, typename Compare, typename Hash>
+template <typename Items, typename KeyOf>
+Vector<typename ShardedMap<Key, T, Compare, Hash>::SizeType>
+ShardedMap<Key, T, Compare, Hash>::GroupByShard(
+    const Items& items, KeyOf key_of, Vector<SizeType>* shard_begin) const {
+  // a counting sort of item indices by shard: the indices of shard i end up
+  // in [(*shard_begin)[i], (*shard_begin)[i + 1]) of the result
+  Vector<SizeType> shard_of(items.Size());
+  Vector<SizeType> begin(shard_mask_ + 2);
+  for (SizeType index {0}; index < shard_mask_ + 2; ++index) {
+    begin.PushBack(0);
+  }
+  for (SizeType i {0}; i < items.Size(); ++i) {
+    shard_of.PushBack(ShardIndex(key_of(items[i])));
+    ++begin[shard_of[i] + 1];
+  }
+  for (SizeType index {0}; index <= shard_mask_; ++index) {
+    begin[index + 1] += begin[index];
+  }
+  Vector<SizeType> order(items.Size());
+  for (SizeType i {0}; i < items.Size(); ++i) {
+    order.PushBack(0);
+  }
+  Vector<SizeType> next {begin};
+  for (SizeType i {0}; i < items.Size(); ++i) {
+    order[next[shard_of[i]]++] = i;
+  }
+  shard_begin->Swap(begin);
+  return order;
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_SHARDED_MAP_H_
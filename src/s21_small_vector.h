@@ -0,0 +1,194 @@
+#ifndef SRC_S21_SMALL_VECTOR_H_
+#define SRC_S21_SMALL_VECTOR_H_
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+
+#include "vector_base.h"
+
+namespace s21 {
+
+// Vector with room for N elements inside the object itself, so a short
+// vector never touches the allocator. Past N the elements move to heap
+// storage and grow as in Vector, by realloc where it can; ShrinkToFit
+// brings them back inline once they fit. Moving a vector that is still
+// inline moves its elements one by one, and the iterators of the
+// moved-from vector then point into its own buffer, not into the new one.
+template <typename T, std::size_t N, typename Allocator = std::allocator<T>>
+class SmallVector : public VectorBase<T, Allocator, N> {
+  static_assert(N > 0, "SmallVector needs room for one inline element");
+  using Base = VectorBase<T, Allocator, N>;
+  using typename Base::AllocatorTraits;
+  using Base::StoredAllocator;
+  using Base::InlineData;
+  using Base::FreeVector;
+  using Base::arr_size_;
+  using Base::capacity_;
+  using Base::arr_;
+
+ public:
+  using ValueType = T;
+  using Reference = T&;
+  using ConstReference = const T&;
+  using Iterator = typename Base::Iterator;
+  using ConstIterator = typename Base::ConstIterator;
+  using SizeType = typename Base::SizeType;
+  using AllocatorType = Allocator;
+  SmallVector() {}
+  explicit SmallVector(const Allocator& allocator) : Base(allocator) {}
+  explicit SmallVector(SizeType n, const Allocator& allocator = Allocator());
+  explicit SmallVector(std::initializer_list<T> const& items,
+                       const Allocator& allocator = Allocator());
+  SmallVector(const SmallVector& other);
+  SmallVector(const SmallVector& other, const Allocator& allocator);
+  SmallVector(SmallVector&& other) noexcept(
+      std::is_nothrow_move_constructible_v<T>);
+  SmallVector& operator=(const SmallVector& other);
+  SmallVector& operator=(SmallVector&& other);
+
+  using Base::IsInline;
+  void Swap(SmallVector& other);  // NOLINT(runtime/references)
+
+ private:
+  void MoveElementsFrom(SmallVector& other);  // NOLINT(runtime/references)
+  void StealStorage(SmallVector& other);  // NOLINT(runtime/references)
+};
+
+template <typename T, std::size_t N, typename Allocator>
+SmallVector<T, N, Allocator>::SmallVector(SizeType n,
+                                          const Allocator& allocator)
+    : Base(allocator) {
+  this->Reserve(n);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+SmallVector<T, N, Allocator>::SmallVector(std::initializer_list<T> const& items,
+                                          const Allocator& allocator)
+    : SmallVector(items.size(), allocator) {
+  std::uninitialized_copy(items.begin(), items.end(), arr_);
+  arr_size_ = items.size();
+}
+
+template <typename T, std::size_t N, typename Allocator>
+SmallVector<T, N, Allocator>::SmallVector(const SmallVector& other)
+    : SmallVector(other,
+                  AllocatorTraits::select_on_container_copy_construction(
+                      other.StoredAllocator())) {}
+
+template <typename T, std::size_t N, typename Allocator>
+SmallVector<T, N, Allocator>::SmallVector(const SmallVector& other,
+                                          const Allocator& allocator)
+    : SmallVector(other.arr_size_, allocator) {
+  std::uninitialized_copy(other.arr_, other.arr_ + other.arr_size_, arr_);
+  arr_size_ = other.arr_size_;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+SmallVector<T, N, Allocator>::SmallVector(SmallVector&& other) noexcept(
+    std::is_nothrow_move_constructible_v<T>)
+    : Base(other.StoredAllocator()) {
+  if (other.IsInline()) {
+    MoveElementsFrom(other);
+  } else {
+    StealStorage(other);
+  }
+}
+
+template <typename T, std::size_t N, typename Allocator>
+SmallVector<T, N, Allocator>& SmallVector<T, N, Allocator>::operator=(
+    const SmallVector& other) {
+  if (this == &other) {
+    return *this;
+  }
+  if constexpr (AllocatorTraits::propagate_on_container_copy_assignment::
+                    value) {
+    if (!(StoredAllocator() == other.StoredAllocator())) {
+      FreeVector();
+    }
+    StoredAllocator() = other.StoredAllocator();
+  }
+  // the elements are rebuilt in the storage already held where they fit
+  this->Clear();
+  this->Reserve(other.arr_size_);
+  std::uninitialized_copy(other.arr_, other.arr_ + other.arr_size_, arr_);
+  arr_size_ = other.arr_size_;
+  return *this;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+SmallVector<T, N, Allocator>& SmallVector<T, N, Allocator>::operator=(
+    SmallVector&& other) {
+  if (this == &other) {
+    return *this;
+  }
+  FreeVector();
+  if constexpr (AllocatorTraits::propagate_on_container_move_assignment::
+                    value) {
+    StoredAllocator() = other.StoredAllocator();
+  }
+  // heap storage is taken over when this allocator can free it, inline
+  // elements and storage from another allocator move one by one
+  if (!other.IsInline() && StoredAllocator() == other.StoredAllocator()) {
+    StealStorage(other);
+  } else {
+    MoveElementsFrom(other);
+  }
+  return *this;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void SmallVector<T, N, Allocator>::Swap(SmallVector& other) {
+  if (this == &other) {
+    return;
+  }
+  if (!IsInline() && !other.IsInline()) {
+    std::swap(arr_size_, other.arr_size_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(arr_, other.arr_);
+    if constexpr (AllocatorTraits::propagate_on_container_swap::value) {
+      std::swap(StoredAllocator(), other.StoredAllocator());
+    }
+    return;
+  }
+  // inline elements cannot change hands, so they move through a third
+  // vector
+  SmallVector moved(std::move(other));
+  other = std::move(*this);
+  *this = std::move(moved);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void SmallVector<T, N, Allocator>::MoveElementsFrom(SmallVector& other) {
+  // expects this vector to be empty
+  this->Reserve(other.arr_size_);
+  std::uninitialized_move(other.arr_, other.arr_ + other.arr_size_, arr_);
+  arr_size_ = other.arr_size_;
+  other.Clear();
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void SmallVector<T, N, Allocator>::StealStorage(SmallVector& other) {
+  // expects this vector to be empty and inline, other to be on the heap
+  arr_ = other.arr_;
+  arr_size_ = other.arr_size_;
+  capacity_ = other.capacity_;
+  other.arr_ = other.InlineData();
+  other.arr_size_ = 0;
+  other.capacity_ = N;
+}
+
+namespace pmr {
+
+template <typename T, std::size_t N>
+using SmallVector =
+    s21::SmallVector<T, N, std::pmr::polymorphic_allocator<T>>;
+
+}  // namespace pmr
+
+}  // namespace s21
+
+#endif  // SRC_S21_SMALL_VECTOR_H_
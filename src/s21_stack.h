@@ -3,26 +3,33 @@
 
 #include <cstddef>
 #include <initializer_list>
+#include <memory>
+#include <memory_resource>
 #include <utility>
 
 #include "s21_list.h"
 
 namespace s21 {
 
-template <typename T>
+template <typename T, typename Allocator = std::allocator<T>>
 class Stack {
  public:
   using ValueType = T;
   using Reference = T&;
   using ConstReference = const T&;
   using SizeType = std::size_t;
+  using AllocatorType = Allocator;
   Stack() {}
-  explicit Stack(std::initializer_list<T> const& items) : list_{items} {}
-  Stack(const Stack& other) { *this = other; }
-  Stack(Stack&& other) { *this = std::move(other); }
+  explicit Stack(const Allocator& allocator) : list_(allocator) {}
+  explicit Stack(std::initializer_list<T> const& items,
+                 const Allocator& allocator = Allocator())
+      : list_(items, allocator) {}
+  Stack(const Stack& other) : list_{other.list_} {}
+  Stack(Stack&& other) : list_{std::move(other.list_)} {}
   Stack& operator=(const Stack& other);
   Stack& operator=(Stack&& other);
   ~Stack() {}
+  Allocator GetAllocator() const { return list_.GetAllocator(); }
   T& Top() { return list_.Back(); }
   const T& Top() const { return list_.Back(); }
   bool Empty() const { return list_.Empty(); }
@@ -37,11 +44,12 @@ class Stack {
   }
 
  private:
-    List<T> list_{};
+    List<T, Allocator> list_{};
 };
 
-template <typename T>
-typename Stack<T>::Stack& Stack<T>::operator=(const Stack& other) {
+template <typename T, typename Allocator>
+typename Stack<T, Allocator>::Stack& Stack<T, Allocator>::operator=(
+    const Stack& other) {
   if (this == &other) {
     return *this;
   }
@@ -49,15 +57,23 @@ typename Stack<T>::Stack& Stack<T>::operator=(const Stack& other) {
   return *this;
 }
 
-template <typename T>
-typename Stack<T>::Stack& Stack<T>::operator=(Stack&& other) {
+template <typename T, typename Allocator>
+typename Stack<T, Allocator>::Stack& Stack<T, Allocator>::operator=(
+    Stack&& other) {
   if (this == &other) {
     return *this;
   }
-  list_.Swap(other);
+  list_ = std::move(other.list_);
   return *this;
 }
 
+namespace pmr {
+
+template <typename T>
+using Stack = s21::Stack<T, std::pmr::polymorphic_allocator<T>>;
+
+}  // namespace pmr
+
 }  // namespace s21
 
 #endif  // SRC_S21_STACK_H_
@@ -2,6 +2,82 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace {
+
+class TreeInspector : public s21::BinarySearchTree<int> {
+ public:
+  using s21::BinarySearchTree<int>::Node;
+  SizeType Height() const { return Height(root_); }
+  bool IsValidRedBlackTree() const {
+    return !IsRed(root_) && BlackHeight(root_) >= 0;
+  }
+  bool HasValidSubtreeSizes() const {
+    return CountNodes(root_) == Size();
+  }
+  void MergeUnique(TreeInspector& other) {  // NOLINT(runtime/references)
+    MergeFrom(other, [](Node*, Node*) { return false; });
+  }
+  bool HasValidHeader() const {
+    if (root_ == nullptr) {
+      return header_.left_child == nullptr && header_.right_child == nullptr;
+    }
+    const Node* leftmost {root_};
+    const Node* rightmost {root_};
+    while (leftmost->left_child != nullptr) {
+      leftmost = leftmost->left_child;
+    }
+    while (rightmost->right_child != nullptr) {
+      rightmost = rightmost->right_child;
+    }
+    return root_->ParentBase() == &header_ &&
+           header_.left_child == leftmost && header_.right_child == rightmost;
+  }
+
+ private:
+  static SizeType Height(const Node* node) {
+    if (node == nullptr) {
+      return 0;
+    }
+    return 1 + std::max(Height(node->left_child), Height(node->right_child));
+  }
+  // returns the real node count, or more than the tree holds on a mismatch
+  SizeType CountNodes(const Node* node) const {
+    if (node == nullptr) {
+      return 0;
+    }
+    SizeType count {CountNodes(node->left_child) +
+                    CountNodes(node->right_child) + 1};
+    return count == node->subtree_size ? count : Size() + 1;
+  }
+  static int BlackHeight(const Node* node) {
+    if (node == nullptr) {
+      return 0;
+    }
+    if (IsRed(node) && (IsRed(node->left_child) || IsRed(node->right_child))) {
+      return -1;
+    }
+    int left {BlackHeight(node->left_child)};
+    int right {BlackHeight(node->right_child)};
+    if (left < 0 || left != right) {
+      return -1;
+    }
+    return left + (IsRed(node) ? 0 : 1);
+  }
+};
+
+}  // namespace
+
 TEST(BinarySearchTree, InsertToTree) {
   s21::BinarySearchTree<int> tree{};
   tree.Insert(5);
@@ -118,3 +194,547 @@ TEST(BinarySearchTree, SwapTest) {
   EXPECT_EQ(tree.Size(), 3);
   EXPECT_EQ(tree1.Size(), 2);
 }
+
+TEST(BinarySearchTree, NodeSizeTest) {
+  EXPECT_EQ(sizeof(TreeInspector::Node), 5 * sizeof(void*));
+}
+
+TEST(BinarySearchTree, SortedInsertHeightTest) {
+  TreeInspector tree{};
+  const int size {1 << 16};
+  for (int i {0}; i < size; ++i) {
+    tree.Insert(i);
+  }
+  EXPECT_EQ(tree.Size(), size);
+  EXPECT_TRUE(tree.IsValidRedBlackTree());
+  EXPECT_TRUE(tree.HasValidSubtreeSizes());
+  EXPECT_TRUE(tree.HasValidHeader());
+  EXPECT_LE(tree.Height(), 2 * std::log2(size + 1));
+  int expected {0};
+  for (auto item : tree) {
+    EXPECT_EQ(item, expected++);
+  }
+}
+
+TEST(BinarySearchTree, EraseKeepsBalanceTest) {
+  TreeInspector tree{};
+  const int size {1 << 12};
+  for (int i {size}; i > 0; --i) {
+    tree.Insert(i);
+  }
+  for (int i {1}; i <= size; i += 3) {
+    tree.Erase(tree.Find(i));
+    ASSERT_TRUE(tree.IsValidRedBlackTree());
+  }
+  EXPECT_EQ(tree.Size(), size - (size + 2) / 3);
+  EXPECT_LE(tree.Height(), 2 * std::log2(tree.Size() + 1));
+  EXPECT_TRUE(tree.Find(1) == tree.end());
+  EXPECT_EQ(*tree.Find(2), 2);
+}
+
+TEST(BinarySearchTree, MixedInsertEraseBalanceTest) {
+  TreeInspector tree{};
+  for (int i {0}; i < 2000; ++i) {
+    tree.Insert((i * 7919) % 97);
+    if (i % 3 == 0) {
+      tree.Erase(tree.Find((i * 31) % 97));
+    }
+    ASSERT_TRUE(tree.IsValidRedBlackTree());
+  }
+  int previous {-1};
+  for (auto item : tree) {
+    EXPECT_LE(previous, item);
+    previous = item;
+  }
+}
+
+TEST(BinarySearchTree, CopyKeepsShapeTest) {
+  TreeInspector tree_to_copy{};
+  for (int i {0}; i < 1000; ++i) {
+    tree_to_copy.Insert(i);
+  }
+  TreeInspector tree{};
+  tree.Insert(-1);
+  tree.Insert(5000);
+  tree = tree_to_copy;
+  EXPECT_EQ(tree.Size(), 1000);
+  EXPECT_EQ(tree.Height(), tree_to_copy.Height());
+  EXPECT_TRUE(tree.IsValidRedBlackTree());
+  EXPECT_TRUE(tree.HasValidSubtreeSizes());
+  EXPECT_TRUE(tree.HasValidHeader());
+  EXPECT_TRUE(tree.Find(-1) == tree.end());
+  EXPECT_TRUE(tree.Find(5000) == tree.end());
+  tree.Erase(tree.Find(10));
+  EXPECT_EQ(*tree_to_copy.Find(10), 10);
+  int expected {0};
+  for (auto item : tree_to_copy) {
+    EXPECT_EQ(item, expected++);
+  }
+}
+
+TEST(BinarySearchTree, SelfCopyTest) {
+  s21::BinarySearchTree<int> tree{3, 1, 2};
+  const auto& same_tree {tree};
+  tree = same_tree;
+  EXPECT_EQ(tree.Size(), 3);
+  EXPECT_EQ(*tree.begin(), 1);
+}
+
+TEST(BinarySearchTree, AssignSortedTest) {
+  for (int size {0}; size < 300; ++size) {
+    s21::Vector<int> items{};
+    for (int i {0}; i < size; ++i) {
+      items.PushBack(i / 2);
+    }
+    TreeInspector tree{};
+    tree.Insert(-1);
+    tree.AssignSorted(items.begin(), items.end());
+    ASSERT_EQ(tree.Size(), size);
+    ASSERT_TRUE(tree.IsValidRedBlackTree());
+    EXPECT_LE(tree.Height(), std::log2(size + 1) + 1);
+    int index {0};
+    for (auto item : tree) {
+      EXPECT_EQ(item, index++ / 2);
+    }
+  }
+}
+
+TEST(BinarySearchTree, AssignUnsortedTest) {
+  const int items[] {5, 1, 4, 1, 3};
+  s21::BinarySearchTree<int> tree(items, items + 5);
+  EXPECT_EQ(tree.Size(), 5);
+  auto iter {tree.begin()};
+  EXPECT_EQ(*iter++, 1);
+  EXPECT_EQ(*iter++, 1);
+  EXPECT_EQ(*iter++, 3);
+  EXPECT_EQ(*iter++, 4);
+  EXPECT_EQ(*iter++, 5);
+}
+
+TEST(BinarySearchTree, InsertWithHintTest) {
+  TreeInspector tree{};
+  for (int i {0}; i < 1000; ++i) {
+    tree.Insert(tree.end(), i);
+  }
+  auto hint {tree.begin()};
+  for (int i {0}; i < 500; ++i) {
+    ++hint;
+    hint = tree.Insert(hint, *hint);
+    ++hint;
+  }
+  tree.Insert(tree.begin(), 2000);
+  tree.EmplaceHint(tree.end(), -1);
+  EXPECT_EQ(tree.Size(), 1502);
+  EXPECT_TRUE(tree.IsValidRedBlackTree());
+  EXPECT_TRUE(tree.HasValidSubtreeSizes());
+  EXPECT_TRUE(tree.HasValidHeader());
+  int previous {-2};
+  for (auto value : tree) {
+    EXPECT_LE(previous, value);
+    previous = value;
+  }
+  EXPECT_EQ(*tree.begin(), -1);
+  EXPECT_EQ(*--tree.end(), 2000);
+}
+
+TEST(BinarySearchTree, CustomCompareTest) {
+  s21::BinarySearchTree<int, std::greater<int>> tree {3, 1, 4, 1, 5};
+  auto iter {tree.begin()};
+  EXPECT_EQ(*iter++, 5);
+  EXPECT_EQ(*iter++, 4);
+  EXPECT_EQ(*iter++, 3);
+  EXPECT_EQ(*iter++, 1);
+  EXPECT_EQ(*iter++, 1);
+  EXPECT_TRUE(tree.Contains(4));
+  EXPECT_FALSE(tree.Contains(2));
+}
+
+namespace {
+
+int compare_calls {0};
+
+struct CountingLess {
+  bool operator()(int lhs, int rhs) const {
+    ++compare_calls;
+    return lhs < rhs;
+  }
+};
+
+}  // namespace
+
+TEST(BinarySearchTree, OneComparePerLevelTest) {
+  s21::Vector<int> items{};
+  for (int i {0}; i < 1023; ++i) {
+    items.PushBack(i);
+  }
+  // a perfectly balanced tree of 1023 nodes has 10 levels
+  s21::BinarySearchTree<int, CountingLess> tree(items.begin(), items.end());
+  for (int i {0}; i < 1023; ++i) {
+    compare_calls = 0;
+    EXPECT_TRUE(tree.Contains(i));
+    EXPECT_EQ(compare_calls, 11);
+  }
+  compare_calls = 0;
+  EXPECT_FALSE(tree.Contains(2000));
+  EXPECT_EQ(compare_calls, 10);
+}
+
+TEST(BinarySearchTree, RankSelectTest) {
+  TreeInspector tree{};
+  for (int i {0}; i < 200; ++i) {
+    tree.Insert((i * 37) % 100);
+  }
+  for (int i {0}; i < 100; i += 3) {
+    tree.Erase(tree.Find(i));
+  }
+  EXPECT_TRUE(tree.HasValidSubtreeSizes());
+  EXPECT_TRUE(tree.HasValidHeader());
+  TreeInspector::SizeType index {0};
+  TreeInspector::SizeType first_index {0};
+  for (auto iter {tree.begin()}; iter != tree.end(); ++iter, ++index) {
+    if (index > 0 && *tree.Select(index - 1) != *iter) {
+      first_index = index;
+    }
+    EXPECT_EQ(tree.Select(index), iter);
+    EXPECT_EQ(tree.Rank(*iter), first_index);
+  }
+  EXPECT_EQ(tree.Select(tree.Size()), tree.end());
+  EXPECT_EQ(tree.CountRange(10, 20), 17);
+  EXPECT_EQ(tree.CountRange(20, 10), 0);
+  EXPECT_EQ(tree.Rank(-1), 0);
+  EXPECT_EQ(tree.Rank(1000), tree.Size());
+}
+
+TEST(BinarySearchTree, IteratorSizeTest) {
+  EXPECT_EQ(sizeof(s21::BinarySearchTree<int>::Iterator), sizeof(void*));
+}
+
+TEST(BinarySearchTree, ReverseIterationTest) {
+  s21::BinarySearchTree<int> tree{4, 1, 3, 5, 2};
+  std::vector<int> reversed(tree.rbegin(), tree.rend());
+  EXPECT_EQ(reversed, (std::vector<int> {5, 4, 3, 2, 1}));
+  EXPECT_EQ(*--tree.end(), 5);
+  EXPECT_EQ(++tree.end(), tree.begin());
+  EXPECT_EQ(--tree.begin(), tree.end());
+  s21::BinarySearchTree<int> empty{};
+  EXPECT_EQ(empty.begin(), empty.end());
+  EXPECT_EQ(empty.rbegin(), empty.rend());
+  EXPECT_EQ(--empty.end(), empty.end());
+}
+
+TEST(BinarySearchTree, HeaderTracksEndsTest) {
+  TreeInspector tree{};
+  unsigned state {7};
+  for (int i {0}; i < 2000; ++i) {
+    state = state * 1103515245 + 12345;
+    int value {static_cast<int>(state >> 16) % 500};
+    if (state % 3 == 0) {
+      tree.Erase(tree.Find(value));
+    } else {
+      tree.Insert(value);
+    }
+    ASSERT_TRUE(tree.HasValidHeader());
+  }
+  TreeInspector copy{};
+  copy = tree;
+  EXPECT_TRUE(copy.HasValidHeader());
+  TreeInspector moved{};
+  moved = std::move(copy);
+  EXPECT_TRUE(moved.HasValidHeader());
+  EXPECT_TRUE(copy.HasValidHeader());
+  TreeInspector other{};
+  other.Insert(1000);
+  other.Swap(moved);
+  EXPECT_TRUE(other.HasValidHeader());
+  EXPECT_TRUE(moved.HasValidHeader());
+  EXPECT_EQ(*moved.begin(), 1000);
+  EXPECT_EQ(*--other.end(), *--tree.end());
+  std::vector<int> values(tree.begin(), tree.end());
+  tree.AssignSorted(values.begin(), values.end());
+  EXPECT_TRUE(tree.HasValidHeader());
+  tree.Clear();
+  EXPECT_TRUE(tree.HasValidHeader());
+  EXPECT_EQ(tree.begin(), tree.end());
+}
+
+TEST(BinarySearchTree, EraseRangeTest) {
+  TreeInspector tree{};
+  for (int i {0}; i < 1000; ++i) {
+    tree.Insert(i % 100);
+  }
+  auto last {tree.Erase(tree.Find(10), tree.Find(12))};
+  EXPECT_EQ(*last, 12);
+  EXPECT_EQ(tree.Size(), 980);
+  EXPECT_FALSE(tree.Contains(10));
+  EXPECT_FALSE(tree.Contains(11));
+  EXPECT_TRUE(tree.IsValidRedBlackTree());
+  EXPECT_TRUE(tree.HasValidSubtreeSizes());
+  EXPECT_TRUE(tree.HasValidHeader());
+  EXPECT_EQ(tree.Erase(tree.Find(50), tree.end()), tree.end());
+  EXPECT_EQ(tree.Size(), 480);
+  EXPECT_EQ(*--tree.end(), 49);
+  EXPECT_TRUE(tree.IsValidRedBlackTree());
+  EXPECT_TRUE(tree.HasValidSubtreeSizes());
+  EXPECT_TRUE(tree.HasValidHeader());
+  tree.Erase(tree.begin(), tree.end());
+  EXPECT_TRUE(tree.Empty());
+  EXPECT_TRUE(tree.HasValidHeader());
+}
+
+TEST(BinarySearchTree, EraseKeyTest) {
+  TreeInspector tree{};
+  for (int value : {3, 1, 3, 2, 3}) {
+    tree.Insert(value);
+  }
+  EXPECT_EQ(tree.Erase(3), 3);
+  EXPECT_EQ(tree.Erase(4), 0);
+  EXPECT_EQ(tree.Size(), 2);
+  EXPECT_EQ(tree.Erase(2), 1);
+  EXPECT_EQ(tree.Erase(0), 0);
+  EXPECT_EQ(tree.Size(), 1);
+  EXPECT_EQ(*tree.begin(), 1);
+  EXPECT_TRUE(tree.IsValidRedBlackTree());
+  EXPECT_TRUE(tree.HasValidSubtreeSizes());
+  EXPECT_TRUE(tree.HasValidHeader());
+}
+
+TEST(BinarySearchTree, EraseIfTest) {
+  for (int modulus : {2, 50}) {
+    TreeInspector tree{};
+    for (int i {0}; i < 3000; ++i) {
+      tree.Insert((i * 7) % 3000);
+    }
+    auto erased {tree.EraseIf([modulus](int value) {
+      return value % modulus == 0;
+    })};
+    EXPECT_EQ(erased, static_cast<std::size_t>(3000 / modulus));
+    EXPECT_EQ(tree.Size(), 3000 - erased);
+    int expected {0};
+    for (auto value : tree) {
+      if (expected % modulus == 0) {
+        ++expected;
+      }
+      EXPECT_EQ(value, expected++);
+    }
+    EXPECT_TRUE(tree.IsValidRedBlackTree());
+    EXPECT_TRUE(tree.HasValidSubtreeSizes());
+    EXPECT_TRUE(tree.HasValidHeader());
+  }
+}
+
+TEST(BinarySearchTree, BulkEraseRebuildsTest) {
+  TreeInspector tree{};
+  for (int i {0}; i < 3000; ++i) {
+    tree.Insert((i * 7) % 3000);
+  }
+  EXPECT_EQ(tree.EraseIf([](int value) { return value % 10 != 0; }), 2700);
+  EXPECT_EQ(tree.Size(), 300);
+  EXPECT_EQ(*tree.Select(42), 420);
+  EXPECT_TRUE(tree.IsValidRedBlackTree());
+  EXPECT_TRUE(tree.HasValidSubtreeSizes());
+  EXPECT_TRUE(tree.HasValidHeader());
+  tree.Erase(tree.Find(100), tree.Find(2950));
+  EXPECT_EQ(tree.Size(), 15);
+  EXPECT_EQ(*--tree.end(), 2990);
+  EXPECT_EQ(*tree.Select(10), 2950);
+  EXPECT_TRUE(tree.IsValidRedBlackTree());
+  EXPECT_TRUE(tree.HasValidSubtreeSizes());
+  EXPECT_TRUE(tree.HasValidHeader());
+  tree.Insert(500);
+  EXPECT_EQ(tree.Rank(500), 10);
+  EXPECT_TRUE(tree.IsValidRedBlackTree());
+}
+
+TEST(BinarySearchTree, SplitJoinTest) {
+  for (int size : {0, 1, 2, 7, 100, 1000}) {
+    for (int key : {-1, 0, 1, size / 3, size / 2, size - 1, size}) {
+      TreeInspector tree{};
+      for (int i {0}; i < size; ++i) {
+        tree.Insert((i * 3) % size);
+      }
+      TreeInspector rest{};
+      static_cast<s21::BinarySearchTree<int>&>(rest) = tree.Split(key);
+      int low_size {std::max(0, std::min(key, size))};
+      ASSERT_EQ(tree.Size(), static_cast<std::size_t>(low_size));
+      ASSERT_EQ(rest.Size(), static_cast<std::size_t>(size - low_size));
+      for (auto* part : {&tree, &rest}) {
+        EXPECT_TRUE(part->IsValidRedBlackTree());
+        EXPECT_TRUE(part->HasValidSubtreeSizes());
+        EXPECT_TRUE(part->HasValidHeader());
+      }
+      if (!rest.Empty()) {
+        EXPECT_EQ(*rest.begin(), low_size);
+      }
+      tree.Join(rest);
+      EXPECT_TRUE(rest.Empty());
+      EXPECT_TRUE(rest.HasValidHeader());
+      ASSERT_EQ(tree.Size(), static_cast<std::size_t>(size));
+      EXPECT_TRUE(tree.IsValidRedBlackTree());
+      EXPECT_TRUE(tree.HasValidSubtreeSizes());
+      EXPECT_TRUE(tree.HasValidHeader());
+      int expected {0};
+      for (auto value : tree) {
+        EXPECT_EQ(value, expected++);
+      }
+    }
+  }
+}
+
+TEST(BinarySearchTree, JoinUnevenTreesTest) {
+  TreeInspector small{};
+  TreeInspector large{};
+  for (int i {0}; i < 5; ++i) {
+    small.Insert(i);
+  }
+  for (int i {5}; i < 5000; ++i) {
+    large.Insert(i);
+  }
+  large.Join(small);
+  EXPECT_EQ(large.Size(), 5000);
+  EXPECT_EQ(*large.begin(), 0);
+  EXPECT_EQ(*large.Select(2500), 2500);
+  EXPECT_TRUE(large.IsValidRedBlackTree());
+  EXPECT_TRUE(large.HasValidSubtreeSizes());
+  EXPECT_TRUE(large.HasValidHeader());
+  large.Erase(large.Find(2));
+  large.Insert(2);
+  EXPECT_TRUE(large.IsValidRedBlackTree());
+  TreeInspector overlapping{};
+  overlapping.Insert(100);
+  EXPECT_THROW(large.Join(overlapping), std::invalid_argument);
+  EXPECT_EQ(overlapping.Size(), 1);
+}
+
+TEST(BinarySearchTree, SplitKeepsNodesTest) {
+  s21::BinarySearchTree<int> tree{1, 2, 3, 4};
+  const int* three {&*tree.Find(3)};
+  auto rest {tree.Split(3)};
+  EXPECT_EQ(&*rest.begin(), three);
+  tree.Clear();
+  EXPECT_EQ(*rest.begin(), 3);
+  rest.Insert(5);
+  EXPECT_EQ(*--rest.end(), 5);
+}
+
+TEST(BinarySearchTree, MergeTest) {
+  // the sizes cover both the node by node and the rebuilding merge
+  for (int other_size : {0, 1, 10, 100, 1000, 3000}) {
+    TreeInspector tree{};
+    TreeInspector other{};
+    for (int i {0}; i < 1000; ++i) {
+      tree.Insert(i * 2);
+    }
+    for (int i {0}; i < other_size; ++i) {
+      other.Insert(i * 3);
+    }
+    int shared {std::min((other_size + 1) / 2, 334)};
+    tree.MergeUnique(other);
+    EXPECT_EQ(tree.Size(),
+              static_cast<std::size_t>(1000 + other_size - shared));
+    EXPECT_EQ(other.Size(), static_cast<std::size_t>(shared));
+    for (auto* part : {&tree, &other}) {
+      EXPECT_TRUE(part->IsValidRedBlackTree());
+      EXPECT_TRUE(part->HasValidSubtreeSizes());
+      EXPECT_TRUE(part->HasValidHeader());
+      EXPECT_TRUE(std::is_sorted(part->begin(), part->end()));
+    }
+    for (auto value : other) {
+      EXPECT_EQ(value % 6, 0);
+    }
+    tree.Insert(-1);
+    other.Insert(-1);
+    EXPECT_TRUE(tree.IsValidRedBlackTree());
+    EXPECT_TRUE(other.IsValidRedBlackTree());
+  }
+}
+
+namespace {
+
+// a stateful allocator whose trees hand it over on copy, move and swap
+template <typename T>
+struct TaggedAllocator {
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+  TaggedAllocator() = default;
+  explicit TaggedAllocator(int number) : tag {number} {}
+  template <typename U>
+  TaggedAllocator(const TaggedAllocator<U>& other) : tag {other.tag} {}
+  T* allocate(std::size_t n) { return std::allocator<T>{}.allocate(n); }
+  void deallocate(T* items, std::size_t n) {
+    std::allocator<T>{}.deallocate(items, n);
+  }
+  template <typename U>
+  bool operator==(const TaggedAllocator<U>& other) const {
+    return tag == other.tag;
+  }
+  template <typename U>
+  bool operator!=(const TaggedAllocator<U>& other) const {
+    return tag != other.tag;
+  }
+  int tag {};
+};
+
+}  // namespace
+
+TEST(BinarySearchTree, PmrAllocation) {
+  alignas(std::max_align_t) unsigned char buffer[1 << 17];
+  std::pmr::monotonic_buffer_resource resource {
+      buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+  s21::pmr::BinarySearchTree<int> tree(&resource);
+  for (int i {0}; i < 1000; ++i) {
+    tree.Insert(i);
+  }
+  tree.EraseIf([](int value) { return value % 2 != 0; });
+  auto rest {tree.Split(500)};
+  EXPECT_EQ(tree.Size(), 250U);
+  EXPECT_EQ(rest.Size(), 250U);
+  EXPECT_EQ(rest.GetAllocator().resource(), &resource);
+  tree.Join(rest);
+  EXPECT_EQ(tree.Size(), 500U);
+  EXPECT_TRUE(std::is_sorted(tree.begin(), tree.end()));
+  EXPECT_EQ(tree.GetAllocator().resource(), &resource);
+}
+
+TEST(BinarySearchTree, PmrAcrossResources) {
+  std::pmr::monotonic_buffer_resource first_resource {};
+  std::pmr::monotonic_buffer_resource second_resource {};
+  s21::pmr::BinarySearchTree<int> tree({1, 2, 3}, &first_resource);
+  s21::pmr::BinarySearchTree<int> high({10, 11}, &second_resource);
+  tree.Join(high);
+  EXPECT_EQ(tree.Size(), 5U);
+  EXPECT_TRUE(high.Empty());
+  EXPECT_EQ(high.GetAllocator().resource(), &second_resource);
+  s21::pmr::BinarySearchTree<int> target(&second_resource);
+  target = std::move(tree);
+  EXPECT_EQ(target.GetAllocator().resource(), &second_resource);
+  EXPECT_EQ(target.Size(), 5U);
+  EXPECT_TRUE(tree.Empty());
+  s21::pmr::BinarySearchTree<int> copy(target);
+  EXPECT_EQ(copy.GetAllocator().resource(), std::pmr::get_default_resource());
+  tree = copy;
+  EXPECT_EQ(tree.GetAllocator().resource(), &first_resource);
+  EXPECT_TRUE(std::equal(tree.begin(), tree.end(), target.begin(),
+                         target.end()));
+}
+
+TEST(BinarySearchTree, PropagatingAllocator) {
+  using TaggedTree =
+      s21::BinarySearchTree<int, std::less<int>, TaggedAllocator<int>>;
+  TaggedTree first({1, 2}, TaggedAllocator<int>(1));
+  TaggedTree second({3}, TaggedAllocator<int>(2));
+  second = first;
+  EXPECT_EQ(second.GetAllocator().tag, 1);
+  EXPECT_EQ(second.Size(), 2U);
+  TaggedTree third(TaggedAllocator<int>(3));
+  third = std::move(first);
+  EXPECT_EQ(third.GetAllocator().tag, 1);
+  EXPECT_EQ(third.Size(), 2U);
+  TaggedTree fourth({4}, TaggedAllocator<int>(4));
+  third.Swap(fourth);
+  EXPECT_EQ(third.GetAllocator().tag, 4);
+  EXPECT_EQ(fourth.GetAllocator().tag, 1);
+  fourth.Insert(5);
+  EXPECT_EQ(fourth.Size(), 3U);
+}
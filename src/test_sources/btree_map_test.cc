@@ -0,0 +1,83 @@
+#include "s21_btree_map.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+TEST(BTreeMap, InitializerListConstructorTest) {
+  s21::BTreeMap<char, int> s21_map {{'a', 1}, {'b', 2}, {'a', 3}};
+  ASSERT_EQ(s21_map.Size(), 2);
+  EXPECT_EQ(s21_map.At('a'), 1);
+}
+
+TEST(BTreeMap, CopyAssignmentTest) {
+  s21::BTreeMap<char, int> s21_map1 {{'a', 1}, {'b', 2}, {'a', 3}};
+  s21::BTreeMap<char, int> s21_map2 {};
+  s21_map2 = s21_map1;
+  s21_map1['a'] = 5;
+  ASSERT_EQ(s21_map2.Size(), 2);
+  EXPECT_EQ(s21_map2.At('a'), 1);
+}
+
+TEST(BTreeMap, InsertTest) {
+  s21::BTreeMap<char, int> s21_map {};
+  s21_map.Insert('a', 1);
+  s21_map.Insert('b', 2);
+  auto returnable_pair {s21_map.Insert({'b', 1})};
+  ASSERT_EQ(s21_map.Size(), 2);
+  EXPECT_FALSE(returnable_pair.second);
+  EXPECT_EQ((*returnable_pair.first).second, 2);
+}
+
+TEST(BTreeMap, InsertOrAssignTest) {
+  s21::BTreeMap<char, int> s21_map {};
+  s21_map.Insert('a', 1);
+  s21_map.InsertOrAssign('a', 2);
+  ASSERT_EQ(s21_map.Size(), 1);
+  EXPECT_EQ((*s21_map.begin()).second, 2);
+}
+
+TEST(BTreeMap, AtTest) {
+  s21::BTreeMap<char, int> s21_map {{'a', 1}, {'b', 2}, {'c', 3}};
+  s21_map.At('a') = 5;
+  EXPECT_EQ(s21_map.At('a'), 5);
+  EXPECT_THROW(s21_map.At('d'), std::out_of_range);
+  const s21::BTreeMap<char, int> const_map {{'a', 1}};
+  EXPECT_EQ(const_map.At('a'), 1);
+  EXPECT_THROW(const_map.At('d'), std::out_of_range);
+}
+
+TEST(BTreeMap, SquareBraceTest) {
+  s21::BTreeMap<std::string, std::string> s21_map {};
+  for (int i {0}; i < 1000; ++i) {
+    s21_map[std::to_string(i)] = std::to_string(i * 2);
+  }
+  EXPECT_EQ(s21_map.Size(), 1000);
+  EXPECT_EQ(s21_map["500"], "1000");
+  for (int i {0}; i < 1000; i += 3) {
+    s21_map.Erase(s21_map.Find(std::to_string(i)));
+  }
+  EXPECT_FALSE(s21_map.Contains("3"));
+  EXPECT_EQ(s21_map.At("4"), "8");
+  EXPECT_EQ(s21_map.Size(), 666);
+}
+
+TEST(BTreeMap, MergeTest) {
+  s21::BTreeMap<char, int> s21_map1 {{'a', 1}, {'b', 2}, {'c', 3}};
+  s21::BTreeMap<char, int> s21_map2 {{'a', 5}, {'d', 4}};
+  s21_map1.Merge(s21_map2);
+  EXPECT_EQ(s21_map1['a'], 1);
+  EXPECT_EQ(s21_map2['a'], 5);
+  EXPECT_EQ(s21_map1['d'], 4);
+  EXPECT_EQ(s21_map1.Size(), 4);
+  EXPECT_EQ(s21_map2.Size(), 1);
+}
+
+TEST(BTreeMap, EmplaceTest) {
+  s21::BTreeMap<char, int> s21_map {{'a', 1}};
+  auto vector {s21_map.Emplace(std::make_pair('a', 5),
+                               std::make_pair('d', 4))};
+  EXPECT_EQ(s21_map['a'], 1);
+  EXPECT_EQ(s21_map['d'], 4);
+  EXPECT_FALSE(vector.Front().second);
+}
@@ -0,0 +1,154 @@
+#include "s21_btree_set.h"
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <string>
+#include <utility>
+
+TEST(BTreeSet, InitTest) {
+  s21::BTreeSet<int> int_set {1, 2, 3, 4, 3, 2, 1};
+  EXPECT_EQ(int_set.Size(), 4);
+}
+
+TEST(BTreeSet, CopyConstructorTest) {
+  s21::BTreeSet<int> int_set1 {1, 2, 3, 4, 3, 2, 1};
+  s21::BTreeSet<int> int_set2 {int_set1};
+  EXPECT_EQ(int_set1.Size(), 4);
+  EXPECT_EQ(int_set2.Size(), 4);
+}
+
+TEST(BTreeSet, MoveConstructorTest) {
+  s21::BTreeSet<int> int_set1 {1, 2, 3, 4, 3, 2, 1};
+  s21::BTreeSet<int> int_set2 {std::move(int_set1)};
+  EXPECT_EQ(int_set1.Size(), 0);
+  EXPECT_EQ(int_set2.Size(), 4);
+}
+
+TEST(BTreeSet, InsertTest) {
+  s21::BTreeSet<int> int_set {};
+  EXPECT_TRUE(int_set.Insert(5).second);
+  EXPECT_FALSE(int_set.Insert(5).second);
+  EXPECT_EQ(*int_set.Insert(3).first, 3);
+  EXPECT_EQ(int_set.Size(), 2);
+}
+
+TEST(BTreeSet, ManyNodesTest) {
+  s21::BTreeSet<int> int_set {};
+  const int size {10000};
+  for (int i {0}; i < size; ++i) {
+    int_set.Insert((i * 7919) % size);
+  }
+  EXPECT_EQ(int_set.Size(), size);
+  int expected {0};
+  for (auto item : int_set) {
+    EXPECT_EQ(item, expected++);
+  }
+  auto iter {int_set.end()};
+  for (int i {size - 1}; i >= 0; --i) {
+    EXPECT_EQ(*--iter, i);
+  }
+  for (int i {0}; i < size; i += 2) {
+    int_set.Erase(int_set.Find(i));
+  }
+  EXPECT_EQ(int_set.Size(), size / 2);
+  EXPECT_FALSE(int_set.Contains(0));
+  EXPECT_TRUE(int_set.Contains(size - 1));
+  expected = 1;
+  for (auto item : int_set) {
+    EXPECT_EQ(item, expected);
+    expected += 2;
+  }
+  while (!int_set.Empty()) {
+    int_set.Erase(int_set.begin());
+  }
+  EXPECT_TRUE(int_set.begin() == int_set.end());
+}
+
+TEST(BTreeSet, EraseTest) {
+  s21::BTreeSet<int> int_set {1, 2, 3, 4};
+  int_set.Erase(int_set.begin());
+  int_set.Erase(int_set.end());
+  EXPECT_EQ(int_set.Size(), 3);
+  EXPECT_EQ(*int_set.begin(), 2);
+}
+
+TEST(BTreeSet, SwapTest) {
+  s21::BTreeSet<int> int_set1 {1, 2, 3};
+  s21::BTreeSet<int> int_set2 {5, 6};
+  int_set1.Swap(int_set2);
+  EXPECT_EQ(int_set1.Size(), 2);
+  EXPECT_EQ(*int_set2.begin(), 1);
+}
+
+TEST(BTreeSet, MergeTest) {
+  s21::BTreeSet<int> int_set1 {1, 2, 3};
+  s21::BTreeSet<int> int_set2 {3, 4, 5};
+  int_set1.Merge(int_set2);
+  EXPECT_EQ(int_set1.Size(), 5);
+  EXPECT_EQ(int_set2.Size(), 1);
+  EXPECT_EQ(*int_set2.begin(), 3);
+}
+
+namespace {
+
+struct CopyCounted {
+  CopyCounted(int v) : value {v} {}  // NOLINT(runtime/explicit)
+  CopyCounted(const CopyCounted& other) : value {other.value} { ++copies; }
+  CopyCounted(CopyCounted&& other) noexcept : value {other.value} {}
+  CopyCounted& operator=(const CopyCounted& other) = default;
+  CopyCounted& operator=(CopyCounted&& other) noexcept = default;
+  bool operator<(const CopyCounted& other) const {
+    return value < other.value;
+  }
+  int value{};
+  static inline int copies {0};
+};
+
+}  // namespace
+
+TEST(BTreeSet, MergeMovesValues) {
+  s21::BTreeSet<CopyCounted> set1{};
+  s21::BTreeSet<CopyCounted> set2{};
+  for (int i {0}; i < 200; ++i) {
+    set1.Insert(CopyCounted {i * 2});
+    set2.Insert(CopyCounted {i * 3});
+  }
+  CopyCounted::copies = 0;
+  set1.Merge(set2);
+  EXPECT_EQ(CopyCounted::copies, 0);
+  EXPECT_EQ(set1.Size(), 200 + 200 - 67);
+  EXPECT_EQ(set2.Size(), 67);
+  int previous {-1};
+  for (const auto& item : set2) {
+    EXPECT_EQ(item.value % 6, 0);
+    EXPECT_LT(previous, item.value);
+    previous = item.value;
+  }
+}
+
+TEST(BTreeSet, MergeStrings) {
+  s21::BTreeSet<std::string> set1 {"a", "c", "e"};
+  s21::BTreeSet<std::string> set2 {"b", "c", "d"};
+  set1.Merge(set2);
+  EXPECT_EQ(set1.Size(), 5);
+  EXPECT_EQ(set2.Size(), 1);
+  EXPECT_EQ(*set2.begin(), "c");
+  EXPECT_TRUE(set1.Contains("b"));
+  EXPECT_TRUE(set1.Contains("d"));
+}
+
+TEST(BTreeSet, EmplaceTest) {
+  s21::BTreeSet<int> int_set {1, 2};
+  auto vector {int_set.Emplace(2, 3)};
+  EXPECT_FALSE(vector[0].second);
+  EXPECT_TRUE(vector[1].second);
+  EXPECT_EQ(int_set.Size(), 3);
+}
+
+TEST(BTreeSet, CustomCompareTest) {
+  s21::BTreeSet<int, std::greater<int>> int_set {1, 5, 3, 5};
+  EXPECT_EQ(int_set.Size(), 3);
+  EXPECT_EQ(*int_set.begin(), 5);
+  EXPECT_TRUE(int_set.Contains(1));
+}
@@ -0,0 +1,46 @@
+#include "s21_concurrent_skip_list_map.h"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(ConcurrentSkipListMap, InsertTest) {
+  s21::ConcurrentSkipListMap<int, std::string> map {{2, "two"}, {1, "one"}};
+  EXPECT_TRUE(map.Insert(3, "three").second);
+  EXPECT_FALSE(map.Insert(1, "uno").second);
+  EXPECT_EQ(map.At(1), "one");
+  EXPECT_THROW(map.At(4), std::out_of_range);
+  EXPECT_EQ(map.begin()->first, 1);
+  EXPECT_EQ(map.LowerBound(2)->second, "two");
+  EXPECT_EQ(map.Erase(2), 1);
+  EXPECT_FALSE(map.Contains(2));
+  EXPECT_EQ(map.Size(), 2);
+}
+
+TEST(ConcurrentSkipListMap, ConcurrentTest) {
+  s21::ConcurrentSkipListMap<int, int> map{};
+  std::vector<std::thread> threads{};
+  for (int t {0}; t < 4; ++t) {
+    threads.emplace_back([&map, t]() {
+      for (int i {t}; i < 8000; i += 4) {
+        map.Insert(i, i * 10);
+        if (i >= 4) {
+          EXPECT_EQ(map.At(i - 4), (i - 4) * 10);
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(map.Size(), 8000);
+  int expected {0};
+  for (const auto& entry : map) {
+    EXPECT_EQ(entry.first, expected);
+    EXPECT_EQ(entry.second, expected * 10);
+    ++expected;
+  }
+}
@@ -0,0 +1,133 @@
+#include "s21_concurrent_skip_list_set.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(ConcurrentSkipListSet, InitTest) {
+  s21::ConcurrentSkipListSet<int> set {5, 1, 3, 1, 5};
+  EXPECT_EQ(set.Size(), 3);
+  EXPECT_EQ(*set.begin(), 1);
+  EXPECT_TRUE(s21::ConcurrentSkipListSet<int> {}.Empty());
+}
+
+TEST(ConcurrentSkipListSet, InsertEraseTest) {
+  s21::ConcurrentSkipListSet<std::string> set{};
+  EXPECT_TRUE(set.Insert("b").second);
+  EXPECT_FALSE(set.Insert("b").second);
+  EXPECT_EQ(*set.Insert("a").first, "a");
+  EXPECT_TRUE(set.Contains("a"));
+  EXPECT_EQ(set.Erase(std::string {"a"}), 1);
+  EXPECT_EQ(set.Erase(std::string {"a"}), 0);
+  EXPECT_FALSE(set.Contains("a"));
+  EXPECT_TRUE(set.Find("a") == set.end());
+  EXPECT_EQ(*set.Find("b"), "b");
+  EXPECT_EQ(set.Size(), 1);
+}
+
+TEST(ConcurrentSkipListSet, LowerBoundTest) {
+  s21::ConcurrentSkipListSet<int, std::greater<int>> set {10, 20, 30, 40};
+  EXPECT_EQ(*set.LowerBound(25), 20);
+  EXPECT_EQ(*set.LowerBound(40), 40);
+  EXPECT_TRUE(set.LowerBound(5) == set.end());
+  std::vector<int> values(set.LowerBound(30), set.end());
+  EXPECT_EQ(values, (std::vector<int> {30, 20, 10}));
+}
+
+TEST(ConcurrentSkipListSet, RandomTest) {
+  s21::ConcurrentSkipListSet<int> set{};
+  std::set<int> expected{};
+  unsigned state {3};
+  for (int i {0}; i < 20000; ++i) {
+    state = state * 1103515245 + 12345;
+    int value {static_cast<int>((state >> 16) % 3000)};
+    if (state % 3 == 0) {
+      EXPECT_EQ(set.Erase(value), expected.erase(value));
+    } else {
+      EXPECT_EQ(set.Insert(value).second, expected.insert(value).second);
+    }
+  }
+  EXPECT_EQ(set.Size(), expected.size());
+  EXPECT_TRUE(std::equal(set.begin(), set.end(), expected.begin(),
+                         expected.end()));
+}
+
+TEST(ConcurrentSkipListSet, ConcurrentInsertEraseTest) {
+  // every thread inserts its own residue class and erases half of it,
+  // while all of them fight over one shared range
+  s21::ConcurrentSkipListSet<int> set{};
+  std::atomic<int> shared_inserts {0};
+  std::vector<std::thread> threads{};
+  for (int t {0}; t < 4; ++t) {
+    threads.emplace_back([&set, &shared_inserts, t]() {
+      for (int i {0}; i < 5000; ++i) {
+        set.Insert(i * 4 + t);
+        shared_inserts += set.Insert(-1 - i % 100).second;
+        if (i % 2 == 0) {
+          set.Erase(i * 4 + t);
+        }
+        set.Erase(-1 - (i + 50) % 100);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (int i {0}; i < 20000; ++i) {
+    EXPECT_EQ(set.Contains(i), (i / 4) % 2 == 1);
+  }
+  int previous {std::numeric_limits<int>::min()};
+  std::size_t count {0};
+  for (int value : set) {
+    EXPECT_LT(previous, value);
+    previous = value;
+    ++count;
+  }
+  EXPECT_EQ(count, set.Size());
+  EXPECT_GE(shared_inserts, 100);
+}
+
+TEST(ConcurrentSkipListSet, ConcurrentScanTest) {
+  // scans run while the odd values come and go, and must still see every
+  // even value in order
+  s21::ConcurrentSkipListSet<int> set{};
+  for (int i {0}; i < 4000; i += 2) {
+    set.Insert(i);
+  }
+  std::atomic<bool> done {false};
+  std::thread writer([&set, &done]() {
+    for (int pass {0}; pass < 5; ++pass) {
+      for (int i {1}; i < 4000; i += 2) {
+        set.Insert(i);
+      }
+      for (int i {1}; i < 4000; i += 2) {
+        set.Erase(i);
+      }
+    }
+    done = true;
+  });
+  int scans {0};
+  while (!done || scans == 0) {
+    int expected_even {0};
+    int previous {-1};
+    for (auto iter {set.begin()}; iter != set.end(); ++iter) {
+      ASSERT_LT(previous, *iter);
+      previous = *iter;
+      if (*iter % 2 == 0) {
+        ASSERT_EQ(*iter, expected_even);
+        expected_even += 2;
+      }
+    }
+    EXPECT_EQ(expected_even, 4000);
+    ++scans;
+  }
+  writer.join();
+  EXPECT_EQ(set.Size(), 2000);
+}
@@ -0,0 +1,61 @@
+#include "epoch.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+namespace {
+
+std::atomic<int> freed {0};
+
+void CountFree(void* object) {
+  delete static_cast<int*>(object);
+  ++freed;
+}
+
+void RetireMany(int count) {
+  for (int i {0}; i < count; ++i) {
+    s21::EpochDomain::Global().Retire(new int {i}, CountFree);
+  }
+}
+
+}  // namespace
+
+TEST(Epoch, GuardDelaysFreeTest) {
+  freed = 0;
+  std::atomic<bool> guarded {false};
+  std::atomic<bool> release {false};
+  std::thread reader([&guarded, &release]() {
+    s21::EpochGuard guard{};
+    guarded = true;
+    while (!release) {
+      std::this_thread::yield();
+    }
+  });
+  while (!guarded) {
+    std::this_thread::yield();
+  }
+  // the epoch can advance at most once past the reader, which is not
+  // enough to free anything retired after it entered
+  RetireMany(1000);
+  s21::EpochDomain::Global().Collect();
+  EXPECT_EQ(freed, 0);
+  release = true;
+  reader.join();
+  RetireMany(1000);
+  EXPECT_GT(freed, 0);
+}
+
+TEST(Epoch, NestedGuardTest) {
+  freed = 0;
+  {
+    s21::EpochGuard outer{};
+    {
+      s21::EpochGuard inner{outer};
+    }
+    RetireMany(1000);
+  }
+  RetireMany(1000);
+  EXPECT_GT(freed, 0);
+}
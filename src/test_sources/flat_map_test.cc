@@ -0,0 +1,103 @@
+#include "s21_flat_map.h"
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+TEST(FlatMap, InitTest) {
+  s21::FlatMap<int, std::string> map {{3, "c"}, {1, "a"}, {2, "b"}, {1, "z"}};
+  EXPECT_EQ(map.Size(), 3);
+  EXPECT_EQ(map.At(1), "a");
+  EXPECT_EQ(map.begin()->first, 1);
+  EXPECT_EQ(map.rbegin()->second, "c");
+}
+
+TEST(FlatMap, InsertTest) {
+  s21::FlatMap<int, int> map {};
+  EXPECT_TRUE(map.Insert(2, 20).second);
+  EXPECT_FALSE(map.Insert({2, 30}).second);
+  EXPECT_EQ(map.At(2), 20);
+  EXPECT_FALSE(map.InsertOrAssign(2, 30).second);
+  EXPECT_EQ(map.At(2), 30);
+  EXPECT_TRUE(map.TryEmplace(1, 10).second);
+  EXPECT_EQ(map.Insert(map.end(), {5, 50})->second, 50);
+  EXPECT_EQ(map.EmplaceHint(map.begin(), 4, 40)->first, 4);
+  map[3] = 33;
+  EXPECT_EQ(map.Size(), 5);
+  int expected {1};
+  for (const auto& item : map) {
+    EXPECT_EQ(item.first, expected++);
+  }
+}
+
+TEST(FlatMap, AtTest) {
+  s21::FlatMap<std::string, int, std::less<>> map {{"one", 1}, {"two", 2}};
+  EXPECT_EQ(map.At("two"), 2);
+  map.At(std::string {"one"}) = 11;
+  const auto& const_map {map};
+  EXPECT_EQ(const_map.At("one"), 11);
+  EXPECT_THROW(const_map.At("three"), std::out_of_range);
+  EXPECT_TRUE(map.Contains("one"));
+  EXPECT_EQ(map.Rank("three"), 1);
+}
+
+TEST(FlatMap, EraseTest) {
+  s21::FlatMap<int, int> map {{1, 1}, {2, 2}, {3, 3}};
+  EXPECT_EQ(map.Erase(2), 1);
+  EXPECT_EQ(map.Erase(2), 0);
+  map.Erase(map.begin());
+  EXPECT_EQ(map.Size(), 1);
+  EXPECT_EQ(map.begin()->first, 3);
+}
+
+TEST(FlatMap, MergeAndAlgebraTest) {
+  s21::FlatMap<int, int> map1 {{1, 1}, {3, 3}};
+  s21::FlatMap<int, int> map2 {{2, 2}, {3, 30}};
+  EXPECT_EQ(map1.Union(map2).At(3), 3);
+  EXPECT_EQ(map1.Intersection(map2).Size(), 1);
+  EXPECT_EQ(map1.SymmetricDifference(map2).Size(), 2);
+  map1.Merge(map2);
+  EXPECT_EQ(map1.Size(), 3);
+  EXPECT_EQ(map1.At(3), 3);
+  EXPECT_EQ(map2.Size(), 1);
+  auto rest {map1.Split(2)};
+  EXPECT_EQ(map1.Size(), 1);
+  EXPECT_EQ(rest.CountRange(2, 4), 2);
+}
+
+TEST(FlatMap, EmplaceTest) {
+  s21::FlatMap<int, int> map {{5, 5}};
+  auto result {map.Emplace(std::pair<int, int> {3, 3},
+                           std::pair<int, int> {5, 6})};
+  EXPECT_TRUE(result[0].second);
+  EXPECT_FALSE(result[1].second);
+  EXPECT_EQ(result[0].first->first, 3);
+  EXPECT_EQ(result[1].first->second, 5);
+}
+
+TEST(FlatMap, RandomTest) {
+  s21::FlatMap<int, int> map {};
+  std::map<int, int> reference {};
+  unsigned state {11};
+  for (int i {0}; i < 5000; ++i) {
+    state = state * 1103515245 + 12345;
+    int key {static_cast<int>((state >> 8) % 1000)};
+    if (state % 4 == 0) {
+      EXPECT_EQ(map.Erase(key), reference.erase(key));
+    } else {
+      map[key] += i;
+      reference[key] += i;
+    }
+  }
+  ASSERT_EQ(map.Size(), reference.size());
+  auto iter {map.begin()};
+  for (const auto& item : reference) {
+    EXPECT_EQ(iter->first, item.first);
+    EXPECT_EQ(iter->second, item.second);
+    ++iter;
+  }
+}
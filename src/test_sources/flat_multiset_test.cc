@@ -0,0 +1,116 @@
+#include "s21_flat_multiset.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <set>
+#include <utility>
+#include <vector>
+
+TEST(FlatMultiset, InitTest) {
+  s21::FlatMultiset<int> multiset {3, 1, 2, 3, 1, 3};
+  EXPECT_EQ(multiset.Size(), 6);
+  EXPECT_EQ(multiset.Count(3), 3);
+  EXPECT_EQ(multiset.Count(4), 0);
+  EXPECT_TRUE(std::is_sorted(multiset.begin(), multiset.end()));
+}
+
+TEST(FlatMultiset, InsertTest) {
+  s21::FlatMultiset<int> multiset {};
+  multiset.Insert(2);
+  multiset.Insert(2);
+  multiset.Insert(multiset.begin(), 1);
+  multiset.EmplaceHint(multiset.begin(), 2);
+  EXPECT_EQ(multiset.Size(), 4);
+  EXPECT_EQ(multiset.Count(2), 3);
+  EXPECT_EQ(*multiset.begin(), 1);
+}
+
+TEST(FlatMultiset, BoundsTest) {
+  s21::FlatMultiset<int> multiset {1, 2, 2, 2, 4};
+  auto range {multiset.EqualRange(2)};
+  EXPECT_EQ(range.second - range.first, 3);
+  EXPECT_TRUE(range.first == multiset.Find(2));
+  EXPECT_EQ(*multiset.LowerBound(3), 4);
+  EXPECT_TRUE(multiset.UpperBound(4) == multiset.end());
+  EXPECT_EQ(multiset.Rank(4), 4);
+  EXPECT_EQ(multiset.CountRange(2, 5), 4);
+  EXPECT_EQ(*multiset.Select(3), 2);
+}
+
+TEST(FlatMultiset, EraseTest) {
+  s21::FlatMultiset<int> multiset {1, 2, 2, 2, 4};
+  multiset.Erase(multiset.Find(2));
+  EXPECT_EQ(multiset.Count(2), 2);
+  EXPECT_EQ(multiset.Erase(2), 2);
+  EXPECT_EQ(multiset.Size(), 2);
+}
+
+TEST(FlatMultiset, MergeTest) {
+  s21::FlatMultiset<int> multiset1 {1, 3, 3};
+  s21::FlatMultiset<int> multiset2 {2, 3};
+  multiset1.Merge(multiset2);
+  EXPECT_EQ(multiset1.Size(), 5);
+  EXPECT_EQ(multiset1.Count(3), 3);
+  EXPECT_TRUE(multiset2.Empty());
+}
+
+TEST(FlatMultiset, SetAlgebraTest) {
+  std::vector<int> lhs_values {1, 1, 2, 3, 3, 3, 5};
+  std::vector<int> rhs_values {1, 3, 3, 4, 4, 5, 5};
+  s21::FlatMultiset<int> lhs(lhs_values.begin(), lhs_values.end());
+  s21::FlatMultiset<int> rhs(rhs_values.begin(), rhs_values.end());
+  auto check {[](const s21::FlatMultiset<int>& result,
+                 const std::vector<int>& expected) {
+    EXPECT_TRUE(std::equal(result.begin(), result.end(), expected.begin(),
+                           expected.end()));
+  }};
+  std::vector<int> expected{};
+  std::set_union(lhs_values.begin(), lhs_values.end(), rhs_values.begin(),
+                 rhs_values.end(), std::back_inserter(expected));
+  check(lhs.Union(rhs), expected);
+  expected.clear();
+  std::set_intersection(lhs_values.begin(), lhs_values.end(),
+                        rhs_values.begin(), rhs_values.end(),
+                        std::back_inserter(expected));
+  check(lhs.Intersection(rhs), expected);
+  expected.clear();
+  std::set_difference(lhs_values.begin(), lhs_values.end(), rhs_values.begin(),
+                      rhs_values.end(), std::back_inserter(expected));
+  check(lhs.Difference(rhs), expected);
+  expected.clear();
+  std::set_symmetric_difference(lhs_values.begin(), lhs_values.end(),
+                                rhs_values.begin(), rhs_values.end(),
+                                std::back_inserter(expected));
+  check(lhs.SymmetricDifference(rhs), expected);
+}
+
+TEST(FlatMultiset, EmplaceTest) {
+  s21::FlatMultiset<int> multiset {2};
+  auto result {multiset.Emplace(2, 1, 3)};
+  EXPECT_EQ(result.Size(), 3);
+  EXPECT_EQ(*result[0], 2);
+  EXPECT_EQ(*result[1], 1);
+  EXPECT_EQ(*result[2], 3);
+  EXPECT_EQ(multiset.Count(2), 2);
+}
+
+TEST(FlatMultiset, RandomTest) {
+  s21::FlatMultiset<int> multiset {};
+  std::multiset<int> reference {};
+  unsigned state {3};
+  for (int i {0}; i < 5000; ++i) {
+    state = state * 1103515245 + 12345;
+    int value {static_cast<int>((state >> 8) % 300)};
+    if (state % 3 == 0) {
+      EXPECT_EQ(multiset.Erase(value), reference.erase(value));
+    } else {
+      multiset.Insert(value);
+      reference.insert(value);
+    }
+  }
+  ASSERT_EQ(multiset.Size(), reference.size());
+  EXPECT_TRUE(std::equal(multiset.begin(), multiset.end(), reference.begin(),
+                         reference.end()));
+}
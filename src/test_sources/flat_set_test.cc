@@ -0,0 +1,141 @@
+#include "s21_flat_set.h"
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+TEST(FlatSet, InitTest) {
+  s21::FlatSet<int> int_set {4, 1, 3, 2, 3, 2, 1};
+  EXPECT_EQ(int_set.Size(), 4);
+  int expected {1};
+  for (auto item : int_set) {
+    EXPECT_EQ(item, expected++);
+  }
+}
+
+TEST(FlatSet, CopyAndMoveTest) {
+  s21::FlatSet<int> int_set1 {1, 2, 3, 4};
+  s21::FlatSet<int> int_set2 {int_set1};
+  EXPECT_EQ(int_set1.Size(), 4);
+  EXPECT_EQ(int_set2.Size(), 4);
+  s21::FlatSet<int> int_set3 {std::move(int_set1)};
+  EXPECT_EQ(int_set1.Size(), 0);
+  EXPECT_EQ(int_set3.Size(), 4);
+  EXPECT_TRUE(int_set1.begin() == int_set1.end());
+}
+
+TEST(FlatSet, InsertTest) {
+  s21::FlatSet<int> int_set {};
+  EXPECT_TRUE(int_set.Insert(5).second);
+  EXPECT_FALSE(int_set.Insert(5).second);
+  EXPECT_EQ(*int_set.Insert(3).first, 3);
+  EXPECT_EQ(*int_set.Insert(int_set.end(), 9), 9);
+  EXPECT_EQ(*int_set.Insert(int_set.end(), 4), 4);
+  EXPECT_EQ(*int_set.EmplaceHint(int_set.begin(), 5), 5);
+  EXPECT_EQ(int_set.Size(), 4);
+  EXPECT_EQ(*int_set.Select(2), 5);
+}
+
+TEST(FlatSet, LookupTest) {
+  s21::FlatSet<int> int_set {10, 20, 30, 40};
+  EXPECT_EQ(*int_set.Find(30), 30);
+  EXPECT_TRUE(int_set.Find(35) == int_set.end());
+  EXPECT_TRUE(int_set.Contains(10));
+  EXPECT_FALSE(int_set.Contains(15));
+  EXPECT_EQ(int_set.Rank(25), 2);
+  EXPECT_EQ(int_set.CountRange(15, 40), 2);
+  EXPECT_TRUE(int_set.Select(4) == int_set.end());
+  EXPECT_EQ(*int_set.rbegin(), 40);
+}
+
+TEST(FlatSet, TransparentLookupTest) {
+  s21::FlatSet<std::string, std::less<>> string_set {"b", "a", "c"};
+  EXPECT_TRUE(string_set.Contains("b"));
+  EXPECT_EQ(*string_set.Find("c"), "c");
+  EXPECT_EQ(string_set.Rank("bb"), 2);
+}
+
+TEST(FlatSet, EraseTest) {
+  s21::FlatSet<int> int_set {1, 2, 3, 4, 5, 6};
+  int_set.Erase(int_set.begin());
+  int_set.Erase(int_set.end());
+  EXPECT_EQ(int_set.Erase(4), 1);
+  EXPECT_EQ(int_set.Erase(4), 0);
+  auto iter {int_set.Erase(int_set.begin(), int_set.Find(5))};
+  EXPECT_EQ(*iter, 5);
+  EXPECT_EQ(int_set.Size(), 2);
+  EXPECT_EQ(int_set.EraseIf([](int item) { return item == 6; }), 1);
+  EXPECT_EQ(int_set.Size(), 1);
+}
+
+TEST(FlatSet, MergeTest) {
+  s21::FlatSet<int> int_set1 {1, 3, 5};
+  s21::FlatSet<int> int_set2 {2, 3, 4, 5, 6};
+  int_set1.Merge(int_set2);
+  EXPECT_EQ(int_set1.Size(), 6);
+  EXPECT_EQ(int_set2.Size(), 2);
+  EXPECT_EQ(*int_set2.begin(), 3);
+  int expected {1};
+  for (auto item : int_set1) {
+    EXPECT_EQ(item, expected++);
+  }
+}
+
+TEST(FlatSet, SplitJoinTest) {
+  s21::FlatSet<int> int_set {1, 2, 3, 4, 5};
+  auto rest {int_set.Split(3)};
+  EXPECT_EQ(int_set.Size(), 2);
+  EXPECT_EQ(*rest.begin(), 3);
+  rest.Join(int_set);
+  EXPECT_EQ(rest.Size(), 5);
+  EXPECT_TRUE(int_set.Empty());
+  s21::FlatSet<int> overlapping {2, 9};
+  EXPECT_THROW(rest.Join(overlapping), std::invalid_argument);
+}
+
+TEST(FlatSet, SetAlgebraTest) {
+  s21::FlatSet<int> lhs {1, 2, 3, 4};
+  s21::FlatSet<int> rhs {3, 4, 5};
+  EXPECT_EQ(lhs.Union(rhs).Size(), 5);
+  EXPECT_EQ(lhs.Intersection(rhs).Size(), 2);
+  EXPECT_EQ(*lhs.Difference(rhs).rbegin(), 2);
+  auto symmetric {lhs.SymmetricDifference(rhs)};
+  EXPECT_EQ(symmetric.Size(), 3);
+  EXPECT_TRUE(symmetric.Contains(5));
+}
+
+TEST(FlatSet, EmplaceTest) {
+  s21::FlatSet<int> int_set {5};
+  auto result {int_set.Emplace(3, 5, 7, 1)};
+  EXPECT_EQ(result.Size(), 4);
+  EXPECT_FALSE(result[1].second);
+  for (std::size_t i {0}; i < result.Size(); ++i) {
+    EXPECT_TRUE(result[i].first != int_set.end());
+  }
+  EXPECT_EQ(*result[0].first, 3);
+  EXPECT_EQ(*result[3].first, 1);
+}
+
+TEST(FlatSet, RandomTest) {
+  s21::FlatSet<int> int_set {};
+  std::set<int> reference {};
+  unsigned state {7};
+  for (int i {0}; i < 5000; ++i) {
+    state = state * 1103515245 + 12345;
+    int value {static_cast<int>((state >> 8) % 1000)};
+    if (state % 3 == 0) {
+      EXPECT_EQ(int_set.Erase(value), reference.erase(value));
+    } else {
+      EXPECT_EQ(int_set.Insert(value).second, reference.insert(value).second);
+    }
+  }
+  ASSERT_EQ(int_set.Size(), reference.size());
+  auto iter {int_set.begin()};
+  for (auto item : reference) {
+    EXPECT_EQ(*iter++, item);
+  }
+}
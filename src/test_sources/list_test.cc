@@ -2,6 +2,10 @@
 
 #include <gtest/gtest.h>
 
+#include <cstddef>
+#include <memory_resource>
+#include <utility>
+
 TEST(List, InitTest) {
   s21::List<int> list{};
   ASSERT_TRUE(list.Empty());
@@ -479,3 +483,42 @@ TEST(List, EmplaceEmpty) {
   EXPECT_EQ(*iter++, 3);
   EXPECT_EQ(*iter++, 4);
 }
+
+TEST(List, PmrAllocation) {
+  alignas(std::max_align_t) unsigned char buffer[1 << 14];
+  std::pmr::monotonic_buffer_resource resource {
+      buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+  s21::pmr::List<int> list(&resource);
+  for (int i {0}; i < 100; ++i) {
+    list.PushBack(i);
+    list.PushFront(-i);
+  }
+  list.Sort();
+  list.Unique();
+  list.Reverse();
+  EXPECT_EQ(list.Size(), 199U);
+  EXPECT_EQ(list.Front(), 99);
+  EXPECT_EQ(list.Back(), -99);
+  EXPECT_EQ(list.GetAllocator().resource(), &resource);
+}
+
+TEST(List, PmrMoveAndSpliceAcrossResources) {
+  std::pmr::monotonic_buffer_resource first_resource {};
+  std::pmr::monotonic_buffer_resource second_resource {};
+  s21::pmr::List<int> source({1, 2, 3}, &first_resource);
+  s21::pmr::List<int> target(&second_resource);
+  target = std::move(source);
+  EXPECT_EQ(target.GetAllocator().resource(), &second_resource);
+  EXPECT_TRUE(source.Empty());
+  s21::pmr::List<int> other({4, 5}, &first_resource);
+  target.Splice(target.end(), other);
+  EXPECT_TRUE(other.Empty());
+  int expected {1};
+  for (auto value : target) {
+    EXPECT_EQ(value, expected++);
+  }
+  EXPECT_EQ(expected, 6);
+  s21::pmr::List<int> copy(target);
+  EXPECT_EQ(copy.GetAllocator().resource(), std::pmr::get_default_resource());
+  EXPECT_EQ(copy.Size(), 5U);
+}
@@ -2,6 +2,14 @@
 
 #include <gtest/gtest.h>
 
+#include <cctype>
+#include <cstddef>
+#include <functional>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
 TEST(Map, InitTest) {
   s21::Map<char, int> s21_map {};
   ASSERT_EQ(s21_map.Size(), 0);
@@ -155,3 +163,247 @@ TEST(Map, EmplaceTest) {
   EXPECT_FALSE(vector.Front().second);
 }
 
+
+TEST(Map, RangeConstructorTest) {
+  s21::Vector<std::pair<char, int>> items {{'a', 1}, {'b', 2}, {'b', 3},
+                                           {'c', 4}};
+  s21::Map<char, int> s21_map(items.begin(), items.end());
+  EXPECT_EQ(s21_map.Size(), 3);
+  EXPECT_EQ(s21_map.At('b'), 2);
+  EXPECT_EQ(s21_map.At('c'), 4);
+}
+
+TEST(Map, AssignUnsortedTest) {
+  const std::pair<const char, int> items[] {{'c', 1}, {'a', 2}, {'c', 3}};
+  s21::Map<char, int> s21_map {{'z', 0}};
+  s21_map.AssignSorted(items, items + 3);
+  EXPECT_EQ(s21_map.Size(), 2);
+  EXPECT_EQ(s21_map.At('c'), 1);
+  EXPECT_FALSE(s21_map.Contains('z'));
+  EXPECT_EQ((*s21_map.begin()).first, 'a');
+}
+
+TEST(Map, InsertWithHintTest) {
+  s21::Map<int, char> s21_map {};
+  for (int i {0}; i < 26; ++i) {
+    s21_map.Insert(s21_map.end(), {i, static_cast<char>('a' + i)});
+  }
+  auto iter {s21_map.EmplaceHint(s21_map.begin(), 5, 'z')};
+  EXPECT_EQ((*iter).second, 'f');
+  iter = s21_map.EmplaceHint(s21_map.begin(), -5, 'z');
+  EXPECT_EQ((*iter).first, -5);
+  EXPECT_EQ(s21_map.Size(), 27);
+  EXPECT_EQ(s21_map.At(25), 'z');
+  EXPECT_EQ(s21_map.At(-5), 'z');
+}
+
+namespace {
+
+struct CaseInsensitiveLess {
+  bool operator()(char lhs, char rhs) const {
+    return std::tolower(lhs) < std::tolower(rhs);
+  }
+};
+
+}  // namespace
+
+TEST(Map, CustomCompareTest) {
+  s21::Map<char, int, CaseInsensitiveLess> s21_map {{'b', 1}, {'A', 2}};
+  EXPECT_FALSE(s21_map.Insert('B', 3).second);
+  EXPECT_EQ(s21_map.At('a'), 2);
+  s21_map['c'] = 4;
+  EXPECT_EQ(s21_map['C'], 4);
+  EXPECT_EQ((*s21_map.begin()).first, 'A');
+  EXPECT_EQ(s21_map.Size(), 3);
+}
+
+TEST(Map, TransparentLookupTest) {
+  s21::Map<std::string, int, std::less<>> s21_map {{"one", 1}, {"two", 2}};
+  const auto& const_map {s21_map};
+  std::string_view key {"two"};
+  EXPECT_EQ(s21_map.At(key), 2);
+  EXPECT_EQ(const_map.At(std::string_view {"one"}), 1);
+  EXPECT_TRUE(s21_map.Contains(key));
+  EXPECT_EQ((*s21_map.Find(key)).second, 2);
+  EXPECT_EQ(s21_map.Find(std::string_view {"three"}), s21_map.end());
+  EXPECT_THROW(s21_map.At(std::string_view {"three"}), std::out_of_range);
+  s21_map.At(key) = 22;
+  EXPECT_EQ(s21_map.At("two"), 22);
+}
+
+TEST(Map, NonTransparentLookupTest) {
+  s21::Map<std::string, int> s21_map {{"one", 1}};
+  EXPECT_EQ(s21_map.At("one"), 1);
+  EXPECT_TRUE(s21_map.Contains("one"));
+}
+
+namespace {
+
+struct ConstructionCounter {
+  ConstructionCounter() { ++constructions; }
+  explicit ConstructionCounter(int initial) : value {initial} {
+    ++constructions;
+  }
+  int value{};
+  static int constructions;
+};
+
+int ConstructionCounter::constructions {0};
+
+}  // namespace
+
+TEST(Map, TryEmplaceTest) {
+  s21::Map<int, ConstructionCounter> s21_map{};
+  auto result {s21_map.TryEmplace(1, 10)};
+  EXPECT_TRUE(result.second);
+  EXPECT_EQ((*result.first).second.value, 10);
+  ConstructionCounter::constructions = 0;
+  result = s21_map.TryEmplace(1, 20);
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ((*result.first).second.value, 10);
+  EXPECT_EQ(ConstructionCounter::constructions, 0);
+  s21_map[1].value = 30;
+  EXPECT_EQ(ConstructionCounter::constructions, 0);
+  EXPECT_EQ(s21_map[2].value, 0);
+  EXPECT_EQ(s21_map.Size(), 2);
+}
+
+TEST(Map, InsertOrAssignStringTest) {
+  s21::Map<std::string, int> s21_map{};
+  EXPECT_TRUE(s21_map.InsertOrAssign("one", 1).second);
+  EXPECT_FALSE(s21_map.InsertOrAssign("one", 11).second);
+  EXPECT_EQ(s21_map.At("one"), 11);
+  EXPECT_EQ(s21_map.Size(), 1);
+}
+
+TEST(Map, RankSelectTest) {
+  s21::Map<int, int> latencies{};
+  for (int i {0}; i < 1000; ++i) {
+    latencies[i * 2] = i;
+  }
+  EXPECT_EQ(latencies.Rank(500), 250);
+  EXPECT_EQ(latencies.Rank(501), 251);
+  EXPECT_EQ((*latencies.Select(990)).first, 1980);
+  EXPECT_EQ(latencies.CountRange(100, 200), 50);
+  EXPECT_EQ(latencies.CountRange(200, 100), 0);
+}
+
+TEST(Map, ReverseIterationTest) {
+  s21::Map<int, std::string> map{{2, "two"}, {1, "one"}, {3, "three"}};
+  auto iter {map.rbegin()};
+  EXPECT_EQ(iter->first, 3);
+  EXPECT_EQ((++iter)->second, "two");
+  EXPECT_EQ((++iter)->first, 1);
+  EXPECT_EQ(++iter, map.rend());
+}
+
+TEST(Map, EraseKeyAndIfTest) {
+  s21::Map<int, std::string> map{{1, "one"}, {2, "two"}, {3, "three"},
+                                 {4, "four"}, {5, "five"}};
+  EXPECT_EQ(map.Erase(2), 1);
+  EXPECT_EQ(map.Erase(2), 0);
+  EXPECT_EQ(map.EraseIf([](const std::pair<const int, std::string>& item) {
+    return item.second.size() == 4;
+  }), 2);
+  EXPECT_EQ(map.Size(), 2);
+  EXPECT_EQ(map.Erase(map.begin(), map.Find(3)), map.Find(3));
+  EXPECT_EQ(map.Size(), 1);
+  EXPECT_EQ(map.At(3), "three");
+}
+
+TEST(Map, SplitJoinTest) {
+  s21::Map<int, std::string> map{};
+  for (int i {0}; i < 100; ++i) {
+    map.Insert(i, std::to_string(i));
+  }
+  auto upper {map.Split(60)};
+  EXPECT_EQ(map.Size(), 60);
+  EXPECT_EQ(upper.Size(), 40);
+  EXPECT_FALSE(map.Contains(60));
+  EXPECT_EQ(upper.At(60), "60");
+  upper[200] = "200";
+  auto middle {upper.Split(80)};
+  EXPECT_EQ(upper.Size(), 20);
+  EXPECT_EQ(middle.Size(), 21);
+  middle.Join(map);
+  EXPECT_EQ(middle.Size(), 81);
+  EXPECT_TRUE(map.Empty());
+  EXPECT_EQ(middle.Rank(80), 60);
+  s21::Map<int, std::string> touching{{79, "again"}};
+  EXPECT_THROW(upper.Join(touching), std::invalid_argument);
+  EXPECT_THROW(upper.Join(middle), std::invalid_argument);
+  touching.Erase(79);
+  touching.Join(upper);
+  EXPECT_EQ(touching.Size(), 20);
+  EXPECT_EQ(touching.At(79), "79");
+  EXPECT_TRUE(upper.Empty());
+  auto low {middle.Split(80)};
+  low.Join(touching);
+  low.Join(middle);
+  EXPECT_EQ(low.Size(), 101);
+  int expected {0};
+  for (const auto& item : low) {
+    EXPECT_EQ(item.first, expected);
+    expected = expected == 99 ? 200 : expected + 1;
+  }
+}
+
+TEST(Map, SetAlgebraTest) {
+  s21::Map<int, std::string> lhs {{1, "a"}, {2, "b"}, {3, "c"}};
+  s21::Map<int, std::string> rhs {{2, "x"}, {3, "y"}, {4, "z"}};
+  auto united {lhs.Union(rhs)};
+  EXPECT_EQ(united.Size(), 4);
+  EXPECT_EQ(united.At(2), "b");
+  EXPECT_EQ(united.At(4), "z");
+  auto common {lhs.Intersection(rhs)};
+  EXPECT_EQ(common.Size(), 2);
+  EXPECT_EQ(common.At(3), "c");
+  auto only_left {lhs.Difference(rhs)};
+  EXPECT_EQ(only_left.Size(), 1);
+  EXPECT_EQ(only_left.At(1), "a");
+  auto either {lhs.SymmetricDifference(rhs)};
+  EXPECT_EQ(either.Size(), 2);
+  EXPECT_EQ(either.At(1), "a");
+  EXPECT_EQ(either.At(4), "z");
+  EXPECT_FALSE(either.Contains(2));
+}
+
+TEST(Map, MergeLargeTest) {
+  s21::Map<int, int> map{};
+  s21::Map<int, int> other{};
+  for (int i {0}; i < 2000; ++i) {
+    map.Insert(i * 2, 0);
+    other.Insert(i * 5, 1);
+  }
+  map.Merge(other);
+  EXPECT_EQ(map.Size(), 3600);
+  EXPECT_EQ(other.Size(), 400);
+  EXPECT_EQ(map.At(10), 0);
+  EXPECT_EQ(map.At(5), 1);
+  EXPECT_EQ(other.At(10), 1);
+  EXPECT_EQ(map.Rank(5), 3);
+  s21::Map<int, int> few {{-1, 1}, {0, 1}};
+  map.Merge(few);
+  EXPECT_EQ(map.Size(), 3601);
+  EXPECT_EQ(few.Size(), 1);
+  EXPECT_EQ(map.begin()->first, -1);
+}
+
+TEST(Map, PmrAllocation) {
+  alignas(std::max_align_t) unsigned char buffer[1 << 17];
+  std::pmr::monotonic_buffer_resource resource {
+      buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+  s21::pmr::Map<int, int> map(&resource);
+  for (int i {0}; i < 1000; ++i) {
+    map[i % 500] += i;
+  }
+  auto rest {map.Split(250)};
+  EXPECT_EQ(map.Size(), 250U);
+  EXPECT_EQ(rest.At(499), 499 + 999);
+  EXPECT_EQ(rest.GetAllocator().resource(), &resource);
+  s21::pmr::Map<int, int> copy(map);
+  EXPECT_EQ(copy.GetAllocator().resource(), std::pmr::get_default_resource());
+  copy.Merge(rest);
+  EXPECT_EQ(copy.Size(), 500U);
+  EXPECT_TRUE(rest.Empty());
+}
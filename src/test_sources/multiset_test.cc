@@ -2,6 +2,16 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory_resource>
+#include <iterator>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
 TEST(Multiset, InitTest) {
   s21::Multiset<int> multiset {1, 2, 3, 2, 1};
   EXPECT_EQ(multiset.Size(), 5);
@@ -107,3 +117,305 @@ TEST(Multiset, EmplaceTest) {
   EXPECT_EQ(*(--int_set.end()), 8);
 }
 
+
+TEST(Multiset, RangeConstructorTest) {
+  s21::Vector<int> items {1, 2, 2, 2, 3};
+  s21::Multiset<int> int_set(items.begin(), items.end());
+  EXPECT_EQ(int_set.Size(), 5);
+  EXPECT_EQ(int_set.Count(2), 3);
+}
+
+TEST(Multiset, InsertWithHintTest) {
+  s21::Multiset<int> int_set {1, 3, 5};
+  auto iter {int_set.Insert(int_set.Find(3), 3)};
+  EXPECT_EQ(int_set.Count(3), 2);
+  EXPECT_EQ(*++iter, 3);
+  int_set.EmplaceHint(int_set.begin(), 5);
+  int_set.Insert(int_set.end(), 0);
+  EXPECT_EQ(int_set.Size(), 6);
+  EXPECT_EQ(int_set.Count(5), 2);
+  EXPECT_EQ(*int_set.begin(), 0);
+}
+
+TEST(Multiset, CustomCompareTest) {
+  s21::Multiset<int, std::greater<int>> int_set {1, 5, 3, 5, 3, 3};
+  EXPECT_EQ(*int_set.begin(), 5);
+  EXPECT_EQ(int_set.Count(3), 3);
+  EXPECT_EQ(*int_set.UpperBound(3), 1);
+}
+
+TEST(Multiset, TransparentLookupTest) {
+  s21::Multiset<std::string, std::less<>> words {"a", "b", "b", "c"};
+  std::string_view key {"b"};
+  EXPECT_EQ(words.Count(key), 2);
+  EXPECT_EQ(*words.LowerBound(key), "b");
+  EXPECT_EQ(*words.UpperBound(key), "c");
+  auto range {words.EqualRange(key)};
+  EXPECT_EQ(*range.first, "b");
+  EXPECT_EQ(*range.second, "c");
+}
+
+TEST(Multiset, RankSelectTest) {
+  s21::Multiset<int> int_set {5, 1, 3, 3, 3, 7};
+  EXPECT_EQ(int_set.Rank(3), 1);
+  EXPECT_EQ(int_set.Rank(4), 4);
+  EXPECT_EQ(*int_set.Select(3), 3);
+  EXPECT_EQ(*int_set.Select(4), 5);
+  EXPECT_EQ(int_set.CountRange(3, 5), 3);
+}
+
+TEST(Multiset, BoundsTest) {
+  s21::Multiset<int> int_set{};
+  for (int i {0}; i < 1000; ++i) {
+    int_set.Insert(i % 10 * 2);
+  }
+  EXPECT_EQ(int_set.Count(4), 100);
+  EXPECT_EQ(int_set.Count(5), 0);
+  EXPECT_EQ(int_set.LowerBound(4), int_set.Select(200));
+  EXPECT_EQ(int_set.UpperBound(4), int_set.Select(300));
+  EXPECT_EQ(*int_set.LowerBound(5), 6);
+  EXPECT_EQ(*int_set.UpperBound(5), 6);
+  EXPECT_EQ(int_set.LowerBound(19), int_set.end());
+  auto range {int_set.EqualRange(7)};
+  EXPECT_EQ(range.first, range.second);
+  EXPECT_EQ(*range.first, 8);
+}
+
+TEST(Multiset, CompressedIterationTest) {
+  s21::Multiset<int> int_set {3, 1, 3, 2, 3, 1};
+  const int expected[] {1, 1, 2, 3, 3, 3};
+  int index {0};
+  for (auto value : int_set) {
+    EXPECT_EQ(value, expected[index++]);
+  }
+  EXPECT_EQ(index, 6);
+  auto iter {int_set.end()};
+  for (index = 5; index >= 0; --index) {
+    EXPECT_EQ(*--iter, expected[index]);
+  }
+  EXPECT_EQ(iter, int_set.begin());
+  EXPECT_EQ(--iter, int_set.end());
+  EXPECT_EQ(*int_set.Select(4), 3);
+  EXPECT_EQ(int_set.Select(4), ++int_set.Select(3));
+}
+
+TEST(Multiset, CompressedEraseTest) {
+  s21::Multiset<int> int_set {2, 2, 2, 5};
+  auto iter {int_set.Find(2)};
+  int_set.Erase(++iter);
+  EXPECT_EQ(int_set.Count(2), 2);
+  EXPECT_EQ(int_set.Size(), 3);
+  EXPECT_EQ(int_set.Rank(5), 2);
+  int_set.Erase(int_set.Find(2));
+  int_set.Erase(int_set.Find(2));
+  EXPECT_FALSE(int_set.Contains(2));
+  EXPECT_EQ(*int_set.begin(), 5);
+  int_set.Erase(int_set.begin());
+  EXPECT_TRUE(int_set.Empty());
+}
+
+TEST(Multiset, EraseWhileIteratingTest) {
+  s21::Multiset<int> int_set1 {1, 1, 1, 2, 3, 3};
+  std::vector<int> seen{};
+  for (auto iter {int_set1.begin()}; iter != int_set1.end();) {
+    seen.push_back(*iter);
+    iter = int_set1.Erase(iter);
+  }
+  EXPECT_EQ(seen, (std::vector<int> {1, 1, 1, 2, 3, 3}));
+  EXPECT_EQ(int_set1.Size(), 0);
+  s21::Multiset<int> int_set2 {1, 1, 1, 2, 3, 3};
+  for (auto iter {int_set2.begin()}; iter != int_set2.end();) {
+    int_set2.Erase(iter++);
+  }
+  EXPECT_EQ(int_set2.Size(), 0);
+  EXPECT_TRUE(int_set2.Empty());
+}
+
+TEST(Multiset, CompressedMergeAndAssignTest) {
+  s21::Multiset<int> int_set1 {1, 1, 4};
+  s21::Multiset<int> int_set2 {1, 2, 4, 4};
+  int_set1.Merge(int_set2);
+  EXPECT_EQ(int_set1.Size(), 7);
+  EXPECT_EQ(int_set1.Count(1), 3);
+  EXPECT_EQ(int_set1.Count(4), 3);
+  EXPECT_TRUE(int_set2.Empty());
+  const int unsorted[] {5, 3, 5, 5, 3, 1};
+  int_set1.AssignSorted(unsorted, unsorted + 6);
+  EXPECT_EQ(int_set1.Size(), 6);
+  EXPECT_EQ(int_set1.Count(5), 3);
+  EXPECT_EQ(int_set1.Count(3), 2);
+  EXPECT_EQ(int_set1.CountRange(2, 6), 5);
+}
+
+TEST(Multiset, CompressedMatchesStdTest) {
+  s21::Multiset<int> int_set{};
+  std::multiset<int> reference{};
+  unsigned state {12345};
+  for (int step {0}; step < 20000; ++step) {
+    state = state * 1103515245 + 12345;
+    int value {static_cast<int>(state >> 16) % 50};
+    if (state % 3 == 0 && reference.count(value) > 0) {
+      reference.erase(reference.find(value));
+      int_set.Erase(int_set.Find(value));
+    } else if (state % 7 == 0) {
+      reference.insert(value);
+      int_set.Insert(int_set.LowerBound(value), value);
+    } else {
+      reference.insert(value);
+      int_set.Insert(value);
+    }
+  }
+  ASSERT_EQ(int_set.Size(), reference.size());
+  auto iter {int_set.begin()};
+  for (auto value : reference) {
+    EXPECT_EQ(*iter++, value);
+  }
+  for (int value {0}; value < 50; ++value) {
+    EXPECT_EQ(int_set.Count(value), reference.count(value));
+    auto rank {std::distance(reference.begin(), reference.lower_bound(value))};
+    EXPECT_EQ(int_set.Rank(value), static_cast<std::size_t>(rank));
+  }
+}
+
+TEST(Multiset, ReverseIterationTest) {
+  s21::Multiset<int> int_set{2, 1, 2, 3, 1, 2};
+  std::vector<int> reversed(int_set.rbegin(), int_set.rend());
+  EXPECT_EQ(reversed, (std::vector<int> {3, 2, 2, 2, 1, 1}));
+  EXPECT_EQ(*--int_set.end(), 3);
+  s21::Multiset<int> empty{};
+  EXPECT_EQ(empty.rbegin(), empty.rend());
+}
+
+TEST(Multiset, EraseRangeTest) {
+  s21::Multiset<int> int_set{1, 1, 2, 2, 2, 3, 3, 4};
+  auto first {int_set.Find(1)};
+  ++first;
+  auto last {int_set.Find(3)};
+  ++last;
+  auto next {int_set.Erase(first, last)};
+  EXPECT_EQ(*next, 3);
+  std::vector<int> rest(int_set.begin(), int_set.end());
+  EXPECT_EQ(rest, (std::vector<int> {1, 3, 4}));
+  EXPECT_EQ(int_set.Size(), 3);
+  EXPECT_EQ(int_set.Rank(4), 2);
+  s21::Multiset<int> same_value{5, 5, 5, 5};
+  first = same_value.begin();
+  ++first;
+  last = first;
+  ++last;
+  ++last;
+  EXPECT_EQ(*same_value.Erase(first, last), 5);
+  EXPECT_EQ(same_value.Count(5), 2);
+  EXPECT_EQ(same_value.Size(), 2);
+}
+
+TEST(Multiset, EraseKeyAndIfTest) {
+  s21::Multiset<int> int_set{};
+  std::multiset<int> reference{};
+  for (int i {0}; i < 1000; ++i) {
+    int_set.Insert(i % 37);
+    reference.insert(i % 37);
+  }
+  EXPECT_EQ(int_set.Erase(5), reference.erase(5));
+  EXPECT_EQ(int_set.Erase(5), 0);
+  auto erased {int_set.EraseIf([](int value) { return value % 3 == 0; })};
+  std::size_t reference_erased {0};
+  for (auto iter {reference.begin()}; iter != reference.end(); ) {
+    if (*iter % 3 == 0) {
+      iter = reference.erase(iter);
+      ++reference_erased;
+    } else {
+      ++iter;
+    }
+  }
+  EXPECT_EQ(erased, reference_erased);
+  EXPECT_EQ(int_set.Size(), reference.size());
+  EXPECT_TRUE(std::equal(int_set.begin(), int_set.end(), reference.begin(),
+                         reference.end()));
+}
+
+TEST(Multiset, SetAlgebraTest) {
+  std::vector<int> lhs_values {1, 1, 1, 2, 3, 3, 5};
+  std::vector<int> rhs_values {1, 3, 3, 3, 4, 5, 5};
+  s21::Multiset<int> lhs(lhs_values.begin(), lhs_values.end());
+  s21::Multiset<int> rhs(rhs_values.begin(), rhs_values.end());
+  auto to_vector {[](const s21::Multiset<int>& multiset) {
+    return std::vector<int>(multiset.begin(), multiset.end());
+  }};
+  std::vector<int> expected{};
+  std::set_union(lhs_values.begin(), lhs_values.end(), rhs_values.begin(),
+                 rhs_values.end(), std::back_inserter(expected));
+  EXPECT_EQ(to_vector(lhs.Union(rhs)), expected);
+  expected.clear();
+  std::set_intersection(lhs_values.begin(), lhs_values.end(),
+                        rhs_values.begin(), rhs_values.end(),
+                        std::back_inserter(expected));
+  EXPECT_EQ(to_vector(lhs.Intersection(rhs)), expected);
+  expected.clear();
+  std::set_difference(lhs_values.begin(), lhs_values.end(),
+                      rhs_values.begin(), rhs_values.end(),
+                      std::back_inserter(expected));
+  EXPECT_EQ(to_vector(lhs.Difference(rhs)), expected);
+  expected.clear();
+  std::set_symmetric_difference(lhs_values.begin(), lhs_values.end(),
+                                rhs_values.begin(), rhs_values.end(),
+                                std::back_inserter(expected));
+  auto either {lhs.SymmetricDifference(rhs)};
+  EXPECT_EQ(to_vector(either), expected);
+  EXPECT_EQ(either.Size(), expected.size());
+  EXPECT_EQ(either.Count(3), 1);
+}
+
+TEST(Multiset, MergeLargeTest) {
+  // both merge strategies must add up the occurrences of shared values
+  for (int other_size : {3, 3000}) {
+    s21::Multiset<int> multiset{};
+    s21::Multiset<int> other{};
+    std::multiset<int> expected{};
+    for (int i {0}; i < 3000; ++i) {
+      multiset.Insert(i % 500);
+      expected.insert(i % 500);
+    }
+    for (int i {0}; i < other_size; ++i) {
+      other.Insert(i % 700);
+      expected.insert(i % 700);
+    }
+    multiset.Merge(other);
+    EXPECT_TRUE(other.Empty());
+    EXPECT_EQ(multiset.Size(), expected.size());
+    EXPECT_TRUE(std::equal(multiset.begin(), multiset.end(), expected.begin(),
+                           expected.end()));
+    EXPECT_EQ(multiset.Count(10), expected.count(10));
+    EXPECT_EQ(multiset.Rank(600), expected.size() - std::distance(
+        expected.lower_bound(600), expected.end()));
+  }
+}
+
+TEST(Multiset, PmrAllocation) {
+  alignas(std::max_align_t) unsigned char buffer[1 << 16];
+  std::pmr::monotonic_buffer_resource resource {
+      buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+  s21::pmr::Multiset<int> multiset(&resource);
+  for (int i {0}; i < 1000; ++i) {
+    multiset.Insert(i % 10);
+  }
+  EXPECT_EQ(multiset.Size(), 1000U);
+  EXPECT_EQ(multiset.Count(3), 100U);
+  auto both {multiset.Union(multiset)};
+  EXPECT_EQ(both.Count(3), 100U);
+  EXPECT_EQ(both.GetAllocator().resource(), &resource);
+}
+
+TEST(Multiset, PmrMergeAcrossResources) {
+  std::pmr::monotonic_buffer_resource first_resource {};
+  std::pmr::monotonic_buffer_resource second_resource {};
+  s21::pmr::Multiset<int> multiset({1, 1, 2}, &first_resource);
+  s21::pmr::Multiset<int> other({1, 3, 3}, &second_resource);
+  multiset.Merge(other);
+  EXPECT_EQ(multiset.Size(), 6U);
+  EXPECT_EQ(multiset.Count(1), 3U);
+  EXPECT_EQ(multiset.Count(3), 2U);
+  EXPECT_TRUE(other.Empty());
+  EXPECT_EQ(multiset.GetAllocator().resource(), &first_resource);
+  EXPECT_EQ(other.GetAllocator().resource(), &second_resource);
+}
@@ -0,0 +1,91 @@
+#include "node_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+TEST(NodePool, NewDeleteTest) {
+  s21::NodePool<std::string> pool{};
+  std::string* first {pool.New("first")};
+  std::string* second {pool.New(std::string(3, 'a'))};
+  EXPECT_EQ(*first, "first");
+  EXPECT_EQ(*second, "aaa");
+  pool.Delete(first);
+  pool.Delete(second);
+}
+
+TEST(NodePool, ReuseDeletedTest) {
+  s21::NodePool<int> pool{};
+  int* first {pool.New(1)};
+  pool.Delete(first);
+  int* second {pool.New(2)};
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(*second, 2);
+}
+
+TEST(NodePool, ContiguousChunkTest) {
+  s21::NodePool<long> pool{};
+  long* previous {pool.New(0)};
+  for (long i {1}; i < 10; ++i) {
+    long* current {pool.New(i)};
+    EXPECT_EQ(reinterpret_cast<char*>(current) -
+                  reinterpret_cast<char*>(previous),
+              sizeof(long));
+    previous = current;
+  }
+}
+
+TEST(NodePool, ReleaseAndSwapTest) {
+  s21::NodePool<int> pool{};
+  for (int i {0}; i < 1000; ++i) {
+    pool.New(i);
+  }
+  s21::NodePool<int> other{};
+  other.Swap(pool);
+  pool.Release();
+  other.Release();
+  EXPECT_EQ(*other.New(5), 5);
+}
+
+TEST(NodePool, ReserveTest) {
+  s21::NodePool<long> pool{};
+  pool.Reserve(1000);
+  long* previous {pool.New(0)};
+  for (long i {1}; i < 1000; ++i) {
+    long* current {pool.New(i)};
+    EXPECT_EQ(current - previous, 1);
+    previous = current;
+  }
+}
+
+TEST(NodePool, ShareTest) {
+  s21::NodePool<std::string> first{};
+  s21::NodePool<std::string> second{};
+  std::string* from_first {first.New("first")};
+  std::string* from_second {second.New("second")};
+  first.Share(second);
+  first.Delete(from_second);
+  first.Release();
+  EXPECT_EQ(*from_first, "first");
+  second.Delete(from_first);
+  s21::NodePool<std::string> third{};
+  third.Share(second);
+  third.Share(second);
+  EXPECT_EQ(*third.New("third"), "third");
+}
+
+TEST(NodePool, SharedFreeListTest) {
+  s21::NodePool<long> first{};
+  s21::NodePool<long> second{};
+  long* from_first {first.New(1)};
+  first.New(2);
+  EXPECT_FALSE(first.IsShared());
+  first.Share(second);
+  EXPECT_TRUE(first.IsShared());
+  second.Delete(from_first);
+  EXPECT_EQ(first.New(3), from_first);
+  second.Delete(from_first);
+  second.Release();
+  EXPECT_FALSE(first.IsShared());
+  EXPECT_EQ(first.New(4), from_first);
+}
@@ -0,0 +1,66 @@
+#include "s21_persistent_map.h"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+TEST(PersistentMap, InsertTest) {
+  s21::PersistentMap<int, std::string> map {{1, "one"}, {2, "two"}};
+  EXPECT_TRUE(map.Insert(3, "three").second);
+  EXPECT_FALSE(map.Insert(1, "uno").second);
+  EXPECT_EQ(map.At(1), "one");
+  EXPECT_EQ(map.Size(), 3);
+  EXPECT_THROW(map.At(4), std::out_of_range);
+  EXPECT_EQ(map.Find(2)->second, "two");
+  EXPECT_TRUE(map.Find(5) == map.end());
+}
+
+TEST(PersistentMap, InsertOrAssignTest) {
+  s21::PersistentMap<int, std::string> map {{1, "one"}, {2, "two"}};
+  auto snapshot {map};
+  auto result {map.InsertOrAssign(1, "uno")};
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ(result.first->second, "uno");
+  EXPECT_TRUE(map.InsertOrAssign(7, "seven").second);
+  EXPECT_EQ(map.At(1), "uno");
+  EXPECT_EQ(snapshot.At(1), "one");
+  EXPECT_FALSE(snapshot.Contains(7));
+  EXPECT_EQ(map.Erase(2), 1);
+  EXPECT_EQ(snapshot.At(2), "two");
+  EXPECT_EQ(map.Size(), 2);
+}
+
+TEST(PersistentMap, ConcurrentReadersTest) {
+  // readers keep their snapshots while the writer builds new versions
+  s21::PersistentMap<int, int> map{};
+  for (int i {0}; i < 1000; ++i) {
+    map.Insert(i, i);
+  }
+  std::vector<std::thread> readers{};
+  std::vector<long> sums(4);
+  for (int r {0}; r < 4; ++r) {
+    readers.emplace_back([snapshot = map, &sum = sums[r]]() {
+      for (int pass {0}; pass < 20; ++pass) {
+        for (int i {0}; i < 1000; ++i) {
+          sum += snapshot.At(i);
+        }
+      }
+    });
+  }
+  for (int i {0}; i < 1000; ++i) {
+    map.InsertOrAssign(i, -i);
+    map.Erase(i / 2);
+  }
+  for (auto& reader : readers) {
+    reader.join();
+  }
+  for (auto sum : sums) {
+    EXPECT_EQ(sum, 20L * 999 * 1000 / 2);
+  }
+  EXPECT_EQ(map.Size(), 500);
+  EXPECT_EQ(map.At(999), -999);
+}
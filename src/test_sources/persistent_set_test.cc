@@ -0,0 +1,129 @@
+#include "s21_persistent_set.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace {
+
+class PersistentInspector : public s21::PersistentSet<int> {
+ public:
+  bool IsValid() const { return IsValid(root_); }
+
+ private:
+  static bool IsValid(const NodePtr& node) {
+    if (node == nullptr) {
+      return true;
+    }
+    SizeType left {SizeOf(node->left_child)};
+    SizeType right {SizeOf(node->right_child)};
+    return node->subtree_size == left + right + 1 &&
+           left + 1 <= kDelta * (right + 1) &&
+           right + 1 <= kDelta * (left + 1) && IsValid(node->left_child) &&
+           IsValid(node->right_child);
+  }
+};
+
+}  // namespace
+
+TEST(PersistentSet, InitTest) {
+  s21::PersistentSet<int> set {3, 1, 2, 3, 1};
+  EXPECT_EQ(set.Size(), 3);
+  EXPECT_EQ(*set.begin(), 1);
+  EXPECT_EQ(*--set.end(), 3);
+  EXPECT_TRUE(s21::PersistentSet<int> {}.Empty());
+}
+
+TEST(PersistentSet, InsertEraseTest) {
+  s21::PersistentSet<int> set{};
+  EXPECT_TRUE(set.Insert(5).second);
+  EXPECT_FALSE(set.Insert(5).second);
+  EXPECT_EQ(*set.Insert(3).first, 3);
+  EXPECT_EQ(set.Erase(5), 1);
+  EXPECT_EQ(set.Erase(5), 0);
+  EXPECT_EQ(set.Size(), 1);
+  EXPECT_TRUE(set.Contains(3));
+  EXPECT_FALSE(set.Contains(5));
+  set.Clear();
+  EXPECT_TRUE(set.Empty());
+  EXPECT_TRUE(set.begin() == set.end());
+}
+
+TEST(PersistentSet, SnapshotTest) {
+  s21::PersistentSet<int> set {1, 2, 3, 4, 5};
+  auto snapshot {set};
+  const int* shared {&*set.Find(1)};
+  set.Insert(6);
+  set.Erase(2);
+  EXPECT_EQ(snapshot.Size(), 5);
+  EXPECT_TRUE(snapshot.Contains(2));
+  EXPECT_FALSE(snapshot.Contains(6));
+  EXPECT_EQ(set.Size(), 5);
+  EXPECT_FALSE(set.Contains(2));
+  EXPECT_EQ(&*snapshot.Find(1), shared);
+  snapshot.Clear();
+  EXPECT_EQ(*set.begin(), 1);
+}
+
+TEST(PersistentSet, PathCopyTest) {
+  // an update shares every node off its search path with the old version
+  s21::PersistentSet<int> set{};
+  for (int i {0}; i < 1024; ++i) {
+    set.Insert(i);
+  }
+  auto next {set};
+  next.Insert(2000);
+  int shared {0};
+  for (int i {0}; i < 1024; ++i) {
+    shared += &*set.Find(i) == &*next.Find(i);
+  }
+  EXPECT_GT(shared, 1000);
+  EXPECT_FALSE(next.Insert(5).second);
+  EXPECT_EQ(&*set.Find(5), &*next.Find(5));
+}
+
+TEST(PersistentSet, IterationTest) {
+  s21::PersistentSet<int, std::greater<int>> set {1, 4, 2, 8, 5};
+  std::vector<int> values(set.begin(), set.end());
+  EXPECT_EQ(values, (std::vector<int> {8, 5, 4, 2, 1}));
+  auto iter {set.end()};
+  EXPECT_EQ(*--iter, 1);
+  EXPECT_EQ(*iter--, 1);
+  EXPECT_EQ(*iter, 2);
+  EXPECT_EQ(set.Rank(4), 2);
+}
+
+TEST(PersistentSet, RandomTest) {
+  PersistentInspector set{};
+  std::set<int> expected{};
+  std::vector<std::pair<s21::PersistentSet<int>, std::set<int>>> versions{};
+  unsigned state {1};
+  for (int i {0}; i < 20000; ++i) {
+    state = state * 1103515245 + 12345;
+    int value {static_cast<int>((state >> 16) % 2000)};
+    if (state % 3 == 0) {
+      EXPECT_EQ(set.Erase(value), expected.erase(value));
+    } else {
+      EXPECT_EQ(set.Insert(value).second, expected.insert(value).second);
+    }
+    if (i % 2000 == 0) {
+      ASSERT_TRUE(set.IsValid());
+      versions.emplace_back(set, expected);
+    }
+  }
+  EXPECT_TRUE(set.IsValid());
+  EXPECT_EQ(set.Size(), expected.size());
+  EXPECT_TRUE(std::equal(set.begin(), set.end(), expected.begin(),
+                         expected.end()));
+  for (const auto& version : versions) {
+    EXPECT_TRUE(std::equal(version.first.begin(), version.first.end(),
+                           version.second.begin(), version.second.end()));
+  }
+  EXPECT_EQ(set.Rank(1000), static_cast<std::size_t>(std::distance(
+                                expected.begin(), expected.lower_bound(1000))));
+}
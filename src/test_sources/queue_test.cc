@@ -1,5 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <cstddef>
+#include <memory_resource>
+#include <utility>
+
 #include "s21_queue.h"
 
 TEST(Queue, Default) {
@@ -174,3 +178,15 @@ TEST(Queue, FrontBack3) {
   EXPECT_DOUBLE_EQ(q.Front(), 2.3);
   EXPECT_DOUBLE_EQ(q.Back(), -5.7);
 }
+
+TEST(Queue, PmrAllocation) {
+  alignas(std::max_align_t) unsigned char buffer[1 << 12];
+  std::pmr::monotonic_buffer_resource resource {
+      buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+  s21::pmr::Queue<int> queue({1, 2}, &resource);
+  queue.Push(3);
+  s21::pmr::Queue<int> moved(std::move(queue));
+  EXPECT_EQ(moved.Front(), 1);
+  EXPECT_EQ(moved.Back(), 3);
+  EXPECT_EQ(moved.GetAllocator().resource(), &resource);
+}
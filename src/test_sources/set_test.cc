@@ -1,4 +1,11 @@
+#include <cstddef>
+#include <functional>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <string_view>
 #include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -109,3 +116,361 @@ TEST(Set, EmplaceTest) {
   EXPECT_TRUE(vector.Back().second);
 }
 
+
+TEST(Set, RangeConstructorTest) {
+  s21::Vector<int> items {1, 2, 2, 3, 5, 5, 5, 8};
+  s21::Set<int> int_set(items.begin(), items.end());
+  EXPECT_EQ(int_set.Size(), 5);
+  EXPECT_TRUE(int_set.Contains(8));
+  EXPECT_FALSE(int_set.Insert(5).second);
+  EXPECT_TRUE(int_set.Insert(4).second);
+}
+
+TEST(Set, AssignUnsortedTest) {
+  const int items[] {3, 1, 2, 3, 1};
+  s21::Set<int> int_set {7};
+  int_set.AssignSorted(items, items + 5);
+  EXPECT_EQ(int_set.Size(), 3);
+  EXPECT_FALSE(int_set.Contains(7));
+  auto iter {int_set.begin()};
+  EXPECT_EQ(*iter++, 1);
+  EXPECT_EQ(*iter++, 2);
+  EXPECT_EQ(*iter++, 3);
+}
+
+TEST(Set, InsertWithHintTest) {
+  s21::Set<int> int_set {};
+  for (int i {0}; i < 100; i += 2) {
+    int_set.Insert(int_set.end(), i);
+  }
+  auto iter {int_set.Insert(int_set.Find(10), 9)};
+  EXPECT_EQ(*iter, 9);
+  EXPECT_EQ(*++iter, 10);
+  iter = int_set.Insert(int_set.begin(), 10);
+  EXPECT_EQ(*iter, 10);
+  iter = int_set.EmplaceHint(int_set.Find(10), 12);
+  EXPECT_EQ(*iter, 12);
+  EXPECT_EQ(int_set.Size(), 51);
+  EXPECT_EQ(*int_set.EmplaceHint(int_set.end(), -1), -1);
+  EXPECT_EQ(*int_set.begin(), -1);
+}
+
+TEST(Set, CustomCompareTest) {
+  s21::Set<int, std::greater<int>> int_set {1, 5, 3, 5};
+  EXPECT_EQ(int_set.Size(), 3);
+  EXPECT_EQ(*int_set.begin(), 5);
+  EXPECT_FALSE(int_set.Insert(3).second);
+  EXPECT_EQ(*int_set.Insert(int_set.end(), 0), 0);
+  EXPECT_EQ(*--int_set.end(), 0);
+}
+
+TEST(Set, TransparentLookupTest) {
+  s21::Set<std::string, std::less<>> string_set {"alpha", "beta", "gamma"};
+  std::string_view key {"beta-suffix"};
+  EXPECT_TRUE(string_set.Contains(key.substr(0, 4)));
+  EXPECT_FALSE(string_set.Contains(key));
+  EXPECT_EQ(*string_set.Find(std::string_view {"gamma"}), "gamma");
+  EXPECT_EQ(string_set.Find("delta"), string_set.end());
+}
+
+namespace {
+
+int compare_calls {0};
+
+struct CountingLess {
+  bool operator()(int lhs, int rhs) const {
+    ++compare_calls;
+    return lhs < rhs;
+  }
+};
+
+}  // namespace
+
+TEST(Set, InsertComparesOncePerLevelTest) {
+  s21::Vector<int> items{};
+  for (int i {0}; i < 1023; i += 2) {
+    items.PushBack(i);
+  }
+  // 512 nodes fill 9 levels and start a 10th
+  s21::Set<int, CountingLess> int_set(items.begin(), items.end());
+  compare_calls = 0;
+  EXPECT_TRUE(int_set.Insert(501).second);
+  EXPECT_LE(compare_calls, 11);
+  compare_calls = 0;
+  EXPECT_FALSE(int_set.Insert(500).second);
+  EXPECT_LE(compare_calls, 11);
+}
+
+TEST(Set, RankSelectTest) {
+  s21::Set<int> int_set {50, 10, 40, 20, 30};
+  EXPECT_EQ(int_set.Rank(30), 2);
+  EXPECT_EQ(int_set.Rank(35), 3);
+  EXPECT_EQ(*int_set.Select(4), 50);
+  EXPECT_EQ(int_set.CountRange(15, 45), 3);
+  int_set.Erase(int_set.Find(20));
+  EXPECT_EQ(*int_set.Select(1), 30);
+  EXPECT_EQ(int_set.Select(4), int_set.end());
+}
+
+TEST(Set, EraseKeyAndIfTest) {
+  s21::Set<int> set{1, 2, 3, 4, 5, 6};
+  EXPECT_EQ(set.Erase(4), 1);
+  EXPECT_EQ(set.Erase(4), 0);
+  EXPECT_EQ(set.EraseIf([](int value) { return value % 2 == 1; }), 3);
+  EXPECT_EQ(set.Size(), 2);
+  EXPECT_EQ(*set.begin(), 2);
+  EXPECT_EQ(*--set.end(), 6);
+}
+
+TEST(Set, SplitJoinTest) {
+  s21::Set<int> set{1, 2, 3, 4, 5, 6};
+  auto rest {set.Split(4)};
+  EXPECT_EQ(set.Size(), 3);
+  EXPECT_EQ(rest.Size(), 3);
+  EXPECT_EQ(*rest.begin(), 4);
+  EXPECT_TRUE(rest.Insert(10).second);
+  EXPECT_FALSE(rest.Insert(4).second);
+  rest.Join(set);
+  EXPECT_EQ(rest.Size(), 7);
+  EXPECT_EQ(*rest.begin(), 1);
+  EXPECT_EQ(*--rest.end(), 10);
+}
+
+TEST(Set, SetAlgebraTest) {
+  s21::Set<int> lhs {1, 2, 3, 5, 8, 13};
+  s21::Set<int> rhs {2, 4, 8, 16};
+  auto to_vector {[](const s21::Set<int>& set) {
+    return std::vector<int>(set.begin(), set.end());
+  }};
+  EXPECT_EQ(to_vector(lhs.Union(rhs)),
+            (std::vector<int> {1, 2, 3, 4, 5, 8, 13, 16}));
+  EXPECT_EQ(to_vector(lhs.Intersection(rhs)), (std::vector<int> {2, 8}));
+  EXPECT_EQ(to_vector(lhs.Difference(rhs)), (std::vector<int> {1, 3, 5, 13}));
+  EXPECT_EQ(to_vector(lhs.SymmetricDifference(rhs)),
+            (std::vector<int> {1, 3, 4, 5, 13, 16}));
+  EXPECT_TRUE(lhs.Intersection(s21::Set<int> {}).Empty());
+  auto same {lhs.Union(lhs)};
+  EXPECT_EQ(to_vector(same), to_vector(lhs));
+  EXPECT_TRUE(same.Insert(4).second);
+  EXPECT_EQ(lhs.Size(), 6);
+}
+
+TEST(Set, MergeLargeTest) {
+  s21::Set<int> evens{};
+  s21::Set<int> threes{};
+  for (int i {0}; i < 3000; ++i) {
+    evens.Insert(i * 2);
+    threes.Insert(i * 3);
+  }
+  evens.Merge(threes);
+  EXPECT_EQ(evens.Size(), 5000);
+  EXPECT_EQ(threes.Size(), 1000);
+  EXPECT_EQ(*threes.begin(), 0);
+  EXPECT_EQ(*--threes.end(), 5994);
+  int previous {-1};
+  for (int value : evens) {
+    EXPECT_LT(previous, value);
+    previous = value;
+  }
+  EXPECT_TRUE(threes.Insert(1).second);
+  EXPECT_FALSE(evens.Insert(9).second);
+}
+
+TEST(Set, PmrAllocation) {
+  alignas(std::max_align_t) unsigned char buffer[1 << 17];
+  std::pmr::monotonic_buffer_resource resource {
+      buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+  s21::pmr::Set<int> set(&resource);
+  for (int i {0}; i < 1000; ++i) {
+    set.Insert(i % 700);
+  }
+  auto rest {set.Split(350)};
+  auto joined {set.Union(rest)};
+  EXPECT_EQ(set.Size(), 350U);
+  EXPECT_EQ(joined.Size(), 700U);
+  EXPECT_EQ(rest.GetAllocator().resource(), &resource);
+  EXPECT_EQ(joined.GetAllocator().resource(), &resource);
+}
+
+namespace {
+
+// counts the bytes that are currently allocated through it
+class CountingResource : public std::pmr::memory_resource {
+ public:
+  std::size_t live_bytes{};
+  std::size_t allocations{};
+
+ private:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+    live_bytes += bytes;
+    ++allocations;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+  void do_deallocate(void* block, std::size_t bytes,
+                     std::size_t alignment) override {
+    live_bytes -= bytes;
+    std::pmr::new_delete_resource()->deallocate(block, bytes, alignment);
+  }
+  bool do_is_equal(
+      const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+};
+
+}  // namespace
+
+TEST(Set, SplitDoesNotRetainChunks) {
+  // the emptied tree must let go of the chunks that now hold only the
+  // nodes of the split off part
+  CountingResource resource{};
+  s21::pmr::Set<int> set(&resource);
+  s21::pmr::Set<int> high(&resource);
+  std::size_t filled_bytes {};
+  for (int round {0}; round < 40; ++round) {
+    for (int i {0}; i < 10000; ++i) {
+      set.Insert(i);
+    }
+    if (round == 0) {
+      filled_bytes = resource.live_bytes;
+    }
+    {
+      auto rest {set.Split(0)};
+      EXPECT_EQ(rest.Size(), 10000U);
+    }
+    EXPECT_TRUE(set.Empty());
+    for (int i {0}; i < 10000; ++i) {
+      high.Insert(i);
+    }
+    set.Join(high);
+    EXPECT_TRUE(high.Empty());
+    EXPECT_EQ(set.Split(10000).Size(), 0U);
+    set.Clear();
+    EXPECT_LE(resource.live_bytes, filled_bytes);
+  }
+}
+
+TEST(Set, RepeatedSplitStaysBounded) {
+  // the dropped half gives its nodes back to the chunks it shares with
+  // set, which refills from them instead of growing the arena
+  CountingResource resource{};
+  s21::pmr::Set<int> set(&resource);
+  for (int i {0}; i < 20000; ++i) {
+    set.Insert(i);
+  }
+  std::size_t filled_bytes {};
+  for (int round {0}; round < 10; ++round) {
+    {
+      auto rest {set.Split(10000)};
+      EXPECT_EQ(rest.Size(), 10000U);
+    }
+    for (int i {10000}; i < 20000; ++i) {
+      set.Insert(i);
+    }
+    EXPECT_EQ(set.Size(), 20000U);
+    if (round == 0) {
+      filled_bytes = resource.live_bytes;
+    }
+    EXPECT_LE(resource.live_bytes, filled_bytes);
+  }
+}
+
+TEST(Set, RepeatedMergeStaysBounded) {
+  // each donor is almost all duplicates, so its one new value is moved
+  // over and its chunks go with it instead of staying with set
+  CountingResource resource{};
+  s21::pmr::Set<int> set(&resource);
+  for (int i {0}; i < 20000; ++i) {
+    set.Insert(i);
+  }
+  std::size_t filled_bytes {};
+  for (int round {0}; round < 10; ++round) {
+    for (int size : {10000, 1000}) {
+      s21::pmr::Set<int> donor(&resource);
+      for (int i {1}; i < size; ++i) {
+        donor.Insert(i);
+      }
+      donor.Insert(100000 + round * 2 + (size == 1000));
+      set.Merge(donor);
+      EXPECT_EQ(donor.Size(), static_cast<std::size_t>(size - 1));
+    }
+    if (round == 0) {
+      filled_bytes = resource.live_bytes;
+    }
+    EXPECT_LE(resource.live_bytes, filled_bytes);
+  }
+  EXPECT_EQ(set.Size(), 20020U);
+}
+
+TEST(Set, EraseKeyDoesNotAllocate) {
+  CountingResource resource{};
+  s21::pmr::Set<int> set(&resource);
+  for (int i {0}; i < 100; ++i) {
+    set.Insert(i);
+  }
+  std::size_t allocations {resource.allocations};
+  for (int i {0}; i < 100; i += 2) {
+    EXPECT_EQ(set.Erase(i), 1U);
+  }
+  EXPECT_EQ(set.Erase(0), 0U);
+  EXPECT_EQ(resource.allocations, allocations);
+  EXPECT_EQ(set.Size(), 50U);
+  EXPECT_EQ(*set.begin(), 1);
+}
+
+TEST(Set, MergeWithoutAdoptionKeepsPoolsApart) {
+  CountingResource resource{};
+  s21::pmr::Set<int> set(&resource);
+  for (int i {0}; i < 1000; ++i) {
+    set.Insert(i);
+  }
+  std::size_t set_bytes {resource.live_bytes};
+  {
+    s21::pmr::Set<int> duplicates(&resource);
+    for (int i {0}; i < 1000; ++i) {
+      duplicates.Insert(i);
+    }
+    set.Merge(duplicates);
+    EXPECT_EQ(duplicates.Size(), 1000U);
+  }
+  EXPECT_EQ(resource.live_bytes, set_bytes);
+}
+
+TEST(Set, RejectedJoinKeepsPoolsApart) {
+  CountingResource resource{};
+  s21::pmr::Set<int> set(&resource);
+  for (int i {0}; i < 1000; ++i) {
+    set.Insert(i);
+  }
+  std::size_t set_bytes {resource.live_bytes};
+  {
+    s21::pmr::Set<int> overlapping(&resource);
+    for (int i {500}; i < 1500; ++i) {
+      overlapping.Insert(i);
+    }
+    EXPECT_THROW(set.Join(overlapping), std::invalid_argument);
+    EXPECT_EQ(overlapping.Size(), 1000U);
+  }
+  EXPECT_EQ(resource.live_bytes, set_bytes);
+  EXPECT_EQ(set.Size(), 1000U);
+}
+
+TEST(Set, PmrAcrossResources) {
+  std::pmr::monotonic_buffer_resource first_resource {};
+  std::pmr::monotonic_buffer_resource second_resource {};
+  s21::pmr::Set<int> set({1, 3, 5}, &first_resource);
+  s21::pmr::Set<int> other({2, 3, 4}, &second_resource);
+  set.Merge(other);
+  EXPECT_EQ(set.Size(), 5U);
+  EXPECT_EQ(other.Size(), 1U);
+  EXPECT_TRUE(other.Contains(3));
+  EXPECT_EQ(other.GetAllocator().resource(), &second_resource);
+  s21::pmr::Set<int> high({10, 11}, &second_resource);
+  set.Join(high);
+  EXPECT_EQ(set.Size(), 7U);
+  EXPECT_TRUE(high.Empty());
+  s21::pmr::Set<int> overlapping({4}, &second_resource);
+  EXPECT_THROW(set.Join(overlapping), std::invalid_argument);
+  EXPECT_EQ(set.Size(), 7U);
+  EXPECT_EQ(overlapping.Size(), 1U);
+  EXPECT_EQ(set.GetAllocator().resource(), &first_resource);
+}
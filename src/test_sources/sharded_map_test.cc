@@ -0,0 +1,85 @@
+#include "s21_sharded_map.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+TEST(ShardedMap, InsertFindTest) {
+  s21::ShardedMap<int, std::string> map{};
+  EXPECT_EQ(map.ShardCount(), 64);
+  EXPECT_TRUE(map.Empty());
+  EXPECT_TRUE(map.Insert(1, "one"));
+  EXPECT_FALSE(map.Insert(1, "uno"));
+  EXPECT_EQ(*map.Find(1), "one");
+  EXPECT_FALSE(map.InsertOrAssign(1, "uno"));
+  EXPECT_TRUE(map.InsertOrAssign(2, "two"));
+  EXPECT_EQ(*map.Find(1), "uno");
+  EXPECT_FALSE(map.Find(3).has_value());
+  EXPECT_TRUE(map.Contains(2));
+  EXPECT_EQ(map.Size(), 2);
+  EXPECT_EQ(map.Erase(2), 1);
+  EXPECT_EQ(map.Erase(2), 0);
+  map.Clear();
+  EXPECT_TRUE(map.Empty());
+}
+
+TEST(ShardedMap, ShardCountTest) {
+  EXPECT_EQ((s21::ShardedMap<int, int>(1).ShardCount()), 1);
+  EXPECT_EQ((s21::ShardedMap<int, int>(5).ShardCount()), 8);
+  s21::ShardedMap<int, int> single(1);
+  for (int i {0}; i < 100; ++i) {
+    single.Insert(i, i);
+  }
+  EXPECT_EQ(single.Size(), 100);
+  EXPECT_EQ(*single.Find(42), 42);
+}
+
+TEST(ShardedMap, BatchTest) {
+  s21::ShardedMap<int, int> map(16);
+  s21::Vector<std::pair<int, int>> items{};
+  for (int i {0}; i < 1000; ++i) {
+    items.PushBack({i % 700, i});
+  }
+  EXPECT_EQ(map.InsertMany(items), 700);
+  EXPECT_EQ(map.Size(), 700);
+  s21::Vector<int> keys{};
+  for (int i {999}; i >= 0; i -= 3) {
+    keys.PushBack(i);
+  }
+  auto found {map.FindMany(keys)};
+  ASSERT_EQ(found.Size(), keys.Size());
+  for (std::size_t i {0}; i < keys.Size(); ++i) {
+    if (keys[i] < 700) {
+      ASSERT_TRUE(found[i].has_value());
+      EXPECT_EQ(*found[i], keys[i]);
+    } else {
+      EXPECT_FALSE(found[i].has_value());
+    }
+  }
+  EXPECT_EQ(map.FindMany(s21::Vector<int>{}).Size(), 0);
+}
+
+TEST(ShardedMap, ConcurrentTest) {
+  s21::ShardedMap<int, int> map(8);
+  std::vector<std::thread> threads{};
+  for (int t {0}; t < 4; ++t) {
+    threads.emplace_back([&map, t]() {
+      for (int i {0}; i < 2000; ++i) {
+        map.Insert(t * 2000 + i, t);
+        if (i % 2 == 0) {
+          map.Erase(t * 2000 + i);
+        }
+        map.Find(i);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(map.Size(), 4000);
+  EXPECT_EQ(*map.Find(2001), 1);
+  EXPECT_FALSE(map.Contains(2000));
+}
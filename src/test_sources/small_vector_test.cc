@@ -0,0 +1,178 @@
+#include "s21_small_vector.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace {
+
+int allocations {0};
+
+// counts the heap blocks the vector asks for
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+  CountingAllocator() = default;
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U>&) {}
+  T* allocate(std::size_t n) {
+    ++allocations;
+    return std::allocator<T>{}.allocate(n);
+  }
+  void deallocate(T* items, std::size_t n) {
+    std::allocator<T>{}.deallocate(items, n);
+  }
+  bool operator==(const CountingAllocator&) const { return true; }
+  bool operator!=(const CountingAllocator&) const { return false; }
+};
+
+template <typename T, std::size_t N>
+using CountedVector = s21::SmallVector<T, N, CountingAllocator<T>>;
+
+}  // namespace
+
+TEST(SmallVector, Default) {
+  s21::SmallVector<int, 4> vector {};
+  EXPECT_TRUE(vector.Empty());
+  EXPECT_TRUE(vector.IsInline());
+  EXPECT_EQ(vector.Capacity(), 4U);
+  EXPECT_THROW(vector.Front(), std::out_of_range);
+  EXPECT_THROW(vector.At(0), std::out_of_range);
+  EXPECT_THROW(vector.Reserve(vector.MaxSize() + 1), std::length_error);
+  EXPECT_TRUE(vector.IsInline());
+}
+
+TEST(SmallVector, StaysInlineUpToN) {
+  allocations = 0;
+  CountedVector<int, 8> vector {};
+  for (int i {0}; i < 8; ++i) {
+    vector.PushBack(i);
+  }
+  vector.Insert(vector.begin(), 100);
+  EXPECT_EQ(allocations, 1);
+  EXPECT_FALSE(vector.IsInline());
+  EXPECT_EQ(vector.Size(), 9U);
+  EXPECT_EQ(vector.Capacity(), 16U);
+  EXPECT_EQ(vector.Front(), 100);
+  EXPECT_EQ(vector.Back(), 7);
+  vector.Erase(vector.begin(), vector.begin() + 4);
+  vector.ShrinkToFit();
+  EXPECT_TRUE(vector.IsInline());
+  EXPECT_EQ(vector.Capacity(), 8U);
+  EXPECT_EQ(vector[0], 3);
+  EXPECT_EQ(vector[4], 7);
+  CountedVector<int, 8> sized(8);
+  EXPECT_TRUE(sized.IsInline());
+  EXPECT_EQ(allocations, 1);
+}
+
+TEST(SmallVector, ReallocatedGrowth) {
+  s21::SmallVector<int, 4> vector {0, 1, 2};
+  for (int i {3}; i < 100; ++i) {
+    vector.PushBack(i);
+  }
+  vector.Insert(vector.begin(), 3, -1);
+  EXPECT_FALSE(vector.IsInline());
+  ASSERT_EQ(vector.Size(), 103U);
+  EXPECT_EQ(vector[2], -1);
+  EXPECT_EQ(vector[3], 0);
+  EXPECT_EQ(vector.Back(), 99);
+  vector.Erase(vector.begin() + 2, vector.end());
+  vector.ShrinkToFit();
+  EXPECT_TRUE(vector.IsInline());
+  EXPECT_EQ(vector.Capacity(), 4U);
+  vector.Reserve(64);
+  EXPECT_FALSE(vector.IsInline());
+  EXPECT_EQ(vector[0], -1);
+  EXPECT_EQ(vector[1], -1);
+}
+
+TEST(SmallVector, Strings) {
+  s21::SmallVector<std::string, 2> vector {"one", "two"};
+  vector.PushBack("three");
+  vector.EmplaceBack("four");
+  vector.Insert(vector.begin() + 1, 2, std::string("x"));
+  std::vector<std::string> expected {"one", "x", "x", "two", "three", "four"};
+  ASSERT_EQ(vector.Size(), expected.size());
+  for (std::size_t i {0}; i < expected.size(); ++i) {
+    EXPECT_EQ(vector.At(i), expected[i]);
+  }
+  EXPECT_EQ(vector.EraseIf([](const std::string& s) { return s == "x"; }), 2U);
+  vector.Erase(vector.begin());
+  vector.PopBack();
+  vector.ShrinkToFit();
+  EXPECT_TRUE(vector.IsInline());
+  EXPECT_EQ(vector[0], "two");
+  EXPECT_EQ(vector[1], "three");
+}
+
+TEST(SmallVector, InsertOwnElements) {
+  s21::SmallVector<std::string, 3> vector {"a", "b", "c"};
+  vector.Insert(vector.begin(), vector.Back());
+  vector.Insert(vector.end(), vector.begin(), vector.end());
+  vector.PushBack(vector[0]);
+  std::vector<std::string> expected {"c", "a", "b", "c", "c",
+                                     "a", "b", "c", "c"};
+  ASSERT_EQ(vector.Size(), expected.size());
+  for (std::size_t i {0}; i < expected.size(); ++i) {
+    EXPECT_EQ(vector[i], expected[i]);
+  }
+}
+
+TEST(SmallVector, CopyAndMove) {
+  s21::SmallVector<std::string, 2> small {"a"};
+  s21::SmallVector<std::string, 2> large {"a", "b", "c"};
+  const std::string* large_data {&large[0]};
+  s21::SmallVector<std::string, 2> copy {small};
+  EXPECT_TRUE(copy.IsInline());
+  copy = large;
+  EXPECT_EQ(copy.Size(), 3U);
+  EXPECT_EQ(copy[2], "c");
+  s21::SmallVector<std::string, 2> moved {std::move(large)};
+  EXPECT_EQ(&moved[0], large_data);
+  EXPECT_TRUE(large.Empty());
+  EXPECT_TRUE(large.IsInline());
+  moved = std::move(small);
+  EXPECT_TRUE(moved.IsInline());
+  EXPECT_EQ(moved[0], "a");
+  EXPECT_TRUE(small.Empty());
+  copy = copy;
+  EXPECT_EQ(copy.Size(), 3U);
+}
+
+TEST(SmallVector, Swap) {
+  s21::SmallVector<int, 2> first {1};
+  s21::SmallVector<int, 2> second {2, 3, 4};
+  s21::SmallVector<int, 2> third {5, 6, 7, 8};
+  first.Swap(second);
+  EXPECT_EQ(first.Size(), 3U);
+  EXPECT_EQ(first[2], 4);
+  EXPECT_EQ(second.Size(), 1U);
+  EXPECT_TRUE(second.IsInline());
+  first.Swap(third);
+  EXPECT_EQ(first.Size(), 4U);
+  EXPECT_EQ(third[0], 2);
+}
+
+TEST(SmallVector, PmrAllocation) {
+  alignas(std::max_align_t) unsigned char buffer[1 << 10];
+  std::pmr::monotonic_buffer_resource resource {
+      buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+  s21::pmr::SmallVector<int, 4> vector(&resource);
+  for (int i {0}; i < 4; ++i) {
+    vector.PushBack(i);
+  }
+  EXPECT_TRUE(vector.IsInline());
+  vector.PushBack(4);
+  EXPECT_FALSE(vector.IsInline());
+  auto* first {reinterpret_cast<unsigned char*>(&vector[0])};
+  EXPECT_TRUE(first >= buffer && first < buffer + sizeof(buffer));
+  EXPECT_EQ(vector.GetAllocator().resource(), &resource);
+}
@@ -2,6 +2,10 @@
 
 #include <gtest/gtest.h>
 
+#include <cstddef>
+#include <memory_resource>
+#include <utility>
+
 TEST(Stack, Default) {
   s21::Stack<int> s{};
   ASSERT_TRUE(s.Empty());
@@ -101,3 +105,15 @@ TEST(Stack, Size) {
   s.Push(2);
   ASSERT_EQ(s.Size(), 5);
 }
+
+TEST(Stack, PmrAllocation) {
+  alignas(std::max_align_t) unsigned char buffer[1 << 12];
+  std::pmr::monotonic_buffer_resource resource {
+      buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+  s21::pmr::Stack<int> stack({1, 2}, &resource);
+  stack.Push(3);
+  s21::pmr::Stack<int> moved(std::move(stack));
+  EXPECT_EQ(moved.Top(), 3);
+  EXPECT_EQ(moved.Size(), 3U);
+  EXPECT_EQ(moved.GetAllocator().resource(), &resource);
+}
@@ -2,6 +2,77 @@
 
 #include <gtest/gtest.h>
 
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// counts what the vector does to its elements
+struct Counted {
+  static int constructed;
+  static int copied;
+  static int moved;
+  static int destroyed;
+  explicit Counted(int number) : value {number} { ++constructed; }
+  Counted(const Counted& other) : value {other.value} { ++copied; }
+  Counted(Counted&& other) noexcept : value {other.value} { ++moved; }
+  Counted& operator=(const Counted& other) = default;
+  Counted& operator=(Counted&& other) = default;
+  ~Counted() { ++destroyed; }
+  static void Reset() { constructed = copied = moved = destroyed = 0; }
+  int value;
+};
+int Counted::constructed {0};
+int Counted::copied {0};
+int Counted::moved {0};
+int Counted::destroyed {0};
+
+// a move constructor that may throw makes growth copy instead
+struct ThrowingMove {
+  explicit ThrowingMove(int number) : value {number} {}
+  ThrowingMove(const ThrowingMove& other) : value {other.value} { ++copies; }
+  ThrowingMove(ThrowingMove&& other) noexcept(false) : value {other.value} {}
+  ThrowingMove& operator=(const ThrowingMove& other) = default;
+  static int copies;
+  int value;
+};
+int ThrowingMove::copies {0};
+
+// a stateful allocator that follows the vector on copy, move and swap
+template <typename T>
+struct TaggedAllocator {
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+  TaggedAllocator() = default;
+  explicit TaggedAllocator(int number) : tag {number} {}
+  template <typename U>
+  TaggedAllocator(const TaggedAllocator<U>& other) : tag {other.tag} {}
+  T* allocate(std::size_t n) { return std::allocator<T>{}.allocate(n); }
+  void deallocate(T* items, std::size_t n) {
+    std::allocator<T>{}.deallocate(items, n);
+  }
+  bool operator==(const TaggedAllocator& other) const {
+    return tag == other.tag;
+  }
+  bool operator!=(const TaggedAllocator& other) const {
+    return tag != other.tag;
+  }
+  int tag {};
+};
+
+}  // namespace
+
 TEST(Vector, Default) {
   s21::Vector<int> MyVector;
   s21::Vector<int> MyVector1(35);
@@ -165,3 +236,285 @@ TEST(Vector, IteratorsTesting) {
   list.Erase((--list.end()));
   EXPECT_EQ(*(--list.end()), 4);
 }
+
+TEST(Vector, ReserveConstructsNothing) {
+  Counted::Reset();
+  s21::Vector<Counted> vector(100);
+  vector.Reserve(1000);
+  EXPECT_EQ(Counted::constructed + Counted::copied + Counted::moved, 0);
+  EXPECT_EQ(vector.Capacity(), 1000);
+  vector.Reserve(10);
+  EXPECT_EQ(vector.Capacity(), 1000);
+}
+
+TEST(Vector, GrowthMovesElements) {
+  Counted::Reset();
+  {
+    s21::Vector<Counted> vector{};
+    for (int i {0}; i < 100; ++i) {
+      vector.EmplaceBack(Counted {i});
+    }
+    EXPECT_EQ(Counted::copied, 0);
+    EXPECT_EQ(vector[57].value, 57);
+    vector.Clear();
+    EXPECT_EQ(vector.Size(), 0);
+    EXPECT_GE(vector.Capacity(), 100);
+  }
+  EXPECT_EQ(Counted::destroyed,
+            Counted::constructed + Counted::copied + Counted::moved);
+}
+
+TEST(Vector, GrowthCopiesThrowingMoves) {
+  ThrowingMove::copies = 0;
+  s21::Vector<ThrowingMove> vector{};
+  for (int i {0}; i < 4; ++i) {
+    vector.PushBack(ThrowingMove {i});
+  }
+  // copies on growth from capacity 1 to 2 and from 2 to 4
+  EXPECT_EQ(ThrowingMove::copies, 3);
+  EXPECT_EQ(vector[3].value, 3);
+}
+
+TEST(Vector, StringElements) {
+  s21::Vector<std::string> vector{};
+  for (int i {0}; i < 50; ++i) {
+    vector.PushBack(std::string(40, static_cast<char>('a' + i % 26)));
+  }
+  vector.PushBack(vector[0]);
+  vector.Insert(vector.begin() + 1, vector[2]);
+  vector.Erase(vector.begin());
+  EXPECT_EQ(vector.Size(), 51);
+  EXPECT_EQ(vector.Front(), std::string(40, 'c'));
+  EXPECT_EQ(vector.Back(), std::string(40, 'a'));
+  s21::Vector<std::string> copy {vector};
+  vector = std::move(copy);
+  EXPECT_EQ(vector[1], std::string(40, 'b'));
+  EXPECT_THROW(vector.At(51), std::out_of_range);
+}
+
+TEST(Vector, EmplaceManyGrowsEnough) {
+  s21::Vector<std::string> vector {"x"};
+  vector.Emplace(vector.begin(), "a", "b", "c", "d", "e");
+  ASSERT_EQ(vector.Size(), 6);
+  EXPECT_EQ(vector[0], "a");
+  EXPECT_EQ(vector[5], "x");
+  vector.Emplace(vector.begin() + 5, "f", "g");
+  EXPECT_EQ(vector[4], "e");
+  EXPECT_EQ(vector[5], "f");
+  EXPECT_EQ(vector[7], "x");
+}
+
+TEST(Vector, TriviallyCopyableElements) {
+  struct Point {
+    int x;
+    double y;
+  };
+  s21::Vector<Point> vector{};
+  for (int i {0}; i < 100000; ++i) {
+    vector.PushBack(Point {i, i * 0.5});
+  }
+  vector.Insert(vector.begin() + 10, Point {-1, -1.0});
+  vector.Emplace(vector.begin(), Point {-2, -2.0}, Point {-3, -3.0});
+  vector.Erase(vector.begin() + 50);
+  ASSERT_EQ(vector.Size(), 100002);
+  EXPECT_EQ(vector[0].x, -2);
+  EXPECT_EQ(vector[1].x, -3);
+  EXPECT_EQ(vector[12].x, -1);
+  EXPECT_EQ(vector[50].x, 48);
+  EXPECT_EQ(vector.Back().y, 99999 * 0.5);
+  vector.ShrinkToFit();
+  EXPECT_EQ(vector.Capacity(), 100002);
+  s21::Vector<Point> copy {vector};
+  EXPECT_EQ(copy[99999].x, 99997);
+}
+
+TEST(Vector, InsertRange) {
+  s21::Vector<int> vector {1, 2, 3};
+  s21::Vector<int> items {7, 8, 9, 10};
+  auto iter {vector.Insert(vector.begin() + 1, items.begin(), items.end())};
+  EXPECT_EQ(*iter, 7);
+  s21::Vector<int> expected {1, 7, 8, 9, 10, 2, 3};
+  ASSERT_EQ(vector.Size(), expected.Size());
+  for (std::size_t i {0}; i < expected.Size(); ++i) {
+    EXPECT_EQ(vector[i], expected[i]);
+  }
+  vector.Insert(vector.end(), vector.begin(), vector.begin() + 2);
+  EXPECT_EQ(vector.Size(), 9);
+  EXPECT_EQ(vector[8], 7);
+  EXPECT_THROW(vector.Insert(vector.end() + 1, items.begin(), items.end()),
+               std::out_of_range);
+}
+
+TEST(Vector, InsertCount) {
+  s21::Vector<std::string> vector {"a", "b"};
+  vector.Insert(vector.begin() + 1, 3, vector[1]);
+  ASSERT_EQ(vector.Size(), 5);
+  EXPECT_EQ(vector[0], "a");
+  for (std::size_t i {1}; i < 5; ++i) {
+    EXPECT_EQ(vector[i], "b");
+  }
+  vector.Insert(vector.begin(), 0, "z");
+  EXPECT_EQ(vector.Size(), 5);
+  s21::Vector<int> numbers{};
+  numbers.Insert(numbers.begin(), 4, 2);
+  EXPECT_EQ(numbers.Size(), 4);
+  EXPECT_EQ(numbers[3], 2);
+}
+
+TEST(Vector, InsertCountCopiesValueOnce) {
+  s21::Vector<Counted> vector {};
+  vector.Reserve(16);
+  for (int i {0}; i < 5; ++i) {
+    vector.PushBack(Counted {i});
+  }
+  Counted::Reset();
+  vector.Insert(vector.begin() + 1, 3, vector[4]);
+  // one copy of the value, assigned over the moved-from tail
+  EXPECT_EQ(Counted::copied, 1);
+  EXPECT_EQ(Counted::moved, 3);
+  int expected[] {0, 4, 4, 4, 1, 2, 3, 4};
+  ASSERT_EQ(vector.Size(), 8U);
+  for (std::size_t i {0}; i < 8; ++i) {
+    EXPECT_EQ(vector[i].value, expected[i]);
+  }
+  Counted::Reset();
+  vector.Insert(vector.end(), 10, vector[0]);
+  EXPECT_EQ(Counted::copied, 11);
+  EXPECT_EQ(Counted::moved, 8);
+  EXPECT_EQ(vector.Size(), 18U);
+  EXPECT_EQ(vector.Back().value, 0);
+}
+
+TEST(Vector, InsertForwardRangeReservesOnce) {
+  std::vector<Counted> items {};
+  for (int i {0}; i < 5; ++i) {
+    items.emplace_back(i);
+  }
+  s21::Vector<Counted> vector {};
+  vector.Reserve(16);
+  vector.PushBack(Counted {10});
+  vector.PushBack(Counted {11});
+  Counted::Reset();
+  vector.Insert(vector.begin(), items.begin(), items.end());
+  // the copied range grows no storage, its elements move in once each
+  EXPECT_EQ(Counted::copied, 5);
+  EXPECT_EQ(Counted::moved, 5);
+  ASSERT_EQ(vector.Size(), 7U);
+  EXPECT_EQ(vector[4].value, 4);
+  EXPECT_EQ(vector[5].value, 10);
+  std::istringstream input {"7 8 9"};
+  s21::Vector<int> numbers {1};
+  numbers.Insert(numbers.begin(), std::istream_iterator<int>(input),
+                 std::istream_iterator<int>());
+  ASSERT_EQ(numbers.Size(), 4U);
+  EXPECT_EQ(numbers[0], 7);
+  EXPECT_EQ(numbers[3], 1);
+}
+
+TEST(Vector, EraseRange) {
+  s21::Vector<std::string> vector {"a", "b", "c", "d", "e"};
+  auto iter {vector.Erase(vector.begin() + 1, vector.begin() + 3)};
+  EXPECT_EQ(*iter, "d");
+  ASSERT_EQ(vector.Size(), 3);
+  EXPECT_EQ(vector[2], "e");
+  vector.Erase(vector.begin() + 2, vector.begin() + 1);
+  EXPECT_EQ(vector.Size(), 3);
+  vector.Erase(vector.begin(), vector.end());
+  EXPECT_TRUE(vector.Empty());
+}
+
+TEST(Vector, EraseIf) {
+  Counted::Reset();
+  {
+    s21::Vector<Counted> vector{};
+    for (int i {0}; i < 10; ++i) {
+      vector.EmplaceBack(Counted {i});
+    }
+    EXPECT_EQ(vector.EraseIf([](const Counted& item) {
+      return item.value % 3 == 0;
+    }), 4);
+    ASSERT_EQ(vector.Size(), 6);
+    EXPECT_EQ(vector[0].value, 1);
+    EXPECT_EQ(vector[5].value, 8);
+  }
+  EXPECT_EQ(Counted::destroyed,
+            Counted::constructed + Counted::copied + Counted::moved);
+}
+
+TEST(Vector, PmrAllocation) {
+  alignas(std::max_align_t) unsigned char buffer[1 << 16];
+  std::pmr::monotonic_buffer_resource resource {
+      buffer, sizeof(buffer), std::pmr::null_memory_resource()};
+  s21::pmr::Vector<int> numbers(&resource);
+  for (int i {0}; i < 1000; ++i) {
+    numbers.PushBack(i);
+  }
+  numbers.Insert(numbers.begin(), 5, -1);
+  s21::pmr::Vector<std::string> words({"a", "b"}, &resource);
+  words.PushBack("c");
+  EXPECT_EQ(numbers.Size(), 1005U);
+  EXPECT_EQ(numbers[4], -1);
+  EXPECT_EQ(numbers[5], 0);
+  EXPECT_EQ(numbers[1004], 999);
+  EXPECT_EQ(words[2], "c");
+  EXPECT_EQ(numbers.GetAllocator().resource(), &resource);
+  auto* first {reinterpret_cast<unsigned char*>(&numbers[0])};
+  EXPECT_TRUE(first >= buffer && first < buffer + sizeof(buffer));
+}
+
+TEST(Vector, PmrPropagation) {
+  std::pmr::monotonic_buffer_resource first_resource {};
+  std::pmr::monotonic_buffer_resource second_resource {};
+  s21::pmr::Vector<int> source({1, 2, 3}, &first_resource);
+  s21::pmr::Vector<int> copy(source);
+  EXPECT_EQ(copy.GetAllocator().resource(), std::pmr::get_default_resource());
+  s21::pmr::Vector<int> target(&second_resource);
+  target = source;
+  EXPECT_EQ(target.GetAllocator().resource(), &second_resource);
+  EXPECT_EQ(target.Size(), 3U);
+  s21::pmr::Vector<int> moved(std::move(source));
+  EXPECT_EQ(moved.GetAllocator().resource(), &first_resource);
+  target = std::move(moved);
+  EXPECT_EQ(target.GetAllocator().resource(), &second_resource);
+  EXPECT_EQ(target[2], 3);
+  EXPECT_TRUE(moved.Empty());
+}
+
+TEST(Vector, PropagatingAllocator) {
+  using TaggedVector = s21::Vector<int, TaggedAllocator<int>>;
+  TaggedVector first({1, 2}, TaggedAllocator<int>(1));
+  TaggedVector second({3}, TaggedAllocator<int>(2));
+  second = first;
+  EXPECT_EQ(second.GetAllocator().tag, 1);
+  EXPECT_EQ(second.Size(), 2U);
+  TaggedVector third(TaggedAllocator<int>(3));
+  third = std::move(first);
+  EXPECT_EQ(third.GetAllocator().tag, 1);
+  EXPECT_EQ(third[1], 2);
+  TaggedVector fourth({4}, TaggedAllocator<int>(4));
+  third.Swap(fourth);
+  EXPECT_EQ(third.GetAllocator().tag, 4);
+  EXPECT_EQ(fourth.GetAllocator().tag, 1);
+  EXPECT_EQ(fourth.Size(), 2U);
+}
+
+TEST(Vector, StatelessAllocatorTakesNoRoom) {
+  EXPECT_EQ(sizeof(s21::Vector<int>), 3 * sizeof(void*));
+  EXPECT_EQ(sizeof(s21::pmr::Vector<int>), 4 * sizeof(void*));
+}
+
+TEST(Vector, ReserveBeyondMaxSizeThrows) {
+  s21::Vector<int> vector {1, 2};
+  EXPECT_EQ(vector.MaxSize(), SIZE_MAX / sizeof(int));
+  // the byte count of these would wrap to a tiny block
+  EXPECT_THROW(vector.Reserve(SIZE_MAX / 4 + 2), std::length_error);
+  EXPECT_THROW(s21::Vector<int>(SIZE_MAX / 2), std::length_error);
+  EXPECT_THROW(vector.Insert(vector.begin(), SIZE_MAX / 2, 0),
+               std::length_error);
+  EXPECT_EQ(vector.Capacity(), 2U);
+  vector.PushBack(3);
+  EXPECT_EQ(vector.Size(), 3U);
+  EXPECT_EQ(vector[2], 3);
+  s21::Vector<std::string> strings {};
+  EXPECT_THROW(strings.Reserve(strings.MaxSize() + 1), std::length_error);
+}
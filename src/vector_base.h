@@ -0,0 +1,761 @@
+#ifndef SRC_VECTOR_BASE_H_
+#define SRC_VECTOR_BASE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "allocator_holder.h"
+
+namespace s21 {
+
+// room for N elements inside the object, none at all for N == 0
+template <typename T, std::size_t N>
+class InlineBuffer {
+ protected:
+  T* InlineData() { return reinterpret_cast<T*>(buffer_); }
+  const T* InlineData() const { return reinterpret_cast<const T*>(buffer_); }
+
+ private:
+  alignas(T) unsigned char buffer_[N * sizeof(T)];
+};
+
+template <typename T>
+class InlineBuffer<T, 0> {
+ protected:
+  T* InlineData() { return nullptr; }
+  const T* InlineData() const { return nullptr; }
+};
+
+// whether a range can be walked twice, so that it is measured first
+template <typename It, typename = void>
+struct IsForwardIterator : std::false_type {};
+
+template <typename It>
+struct IsForwardIterator<
+    It, std::void_t<typename std::iterator_traits<It>::iterator_category>>
+    : std::is_base_of<std::forward_iterator_tag,
+                      typename std::iterator_traits<It>::iterator_category> {};
+
+// Storage and element operations shared by Vector and SmallVector. The
+// elements live either in the N inline slots or in raw storage from the
+// allocator, and are constructed in place, so reserved capacity holds no
+// objects. Growth moves the elements to the new storage, or copies them
+// when T has a throwing move constructor and can be copied, which keeps a
+// failed growth harmless. Trivially copyable elements are plain bytes and
+// are shifted with memmove. With std::allocator they are also kept in
+// malloc storage, so that growth can realloc the block in place, or have a
+// large one remapped, instead of copying it. The derived classes add the
+// constructors, assignments and Swap, which differ in how the storage
+// changes hands.
+template <typename T, typename Allocator, std::size_t N>
+class VectorBase : private AllocatorHolder<Allocator>,
+                   private InlineBuffer<T, N> {
+  using AllocatorBase = AllocatorHolder<Allocator>;
+
+ public:
+  using ValueType = T;
+  using Reference = T&;
+  using ConstReference = const T&;
+  class VectorIterator;
+  class ConstVectorIterator;
+  using Iterator = VectorIterator;
+  using ConstIterator = ConstVectorIterator;
+  using SizeType = std::size_t;
+  using AllocatorType = Allocator;
+  VectorBase(const VectorBase& other) = delete;
+  VectorBase& operator=(const VectorBase& other) = delete;
+  Allocator GetAllocator() const { return StoredAllocator(); }
+
+  T& At(SizeType pos);
+  const T& At(SizeType pos) const;
+  T& operator[](SizeType pos) { return arr_[pos]; }
+  const T& operator[](SizeType pos) const { return arr_[pos]; }
+  T& Front();
+  T& Back();
+  const T& Front() const;
+  const T& Back() const;
+  Iterator Data() { return begin(); }
+  ConstIterator Data() const { return begin(); }
+
+  Iterator begin() { return Iterator(arr_); }
+  Iterator end() { return Iterator(arr_ + arr_size_); }
+
+  ConstIterator begin() const { return ConstIterator(arr_); }
+  ConstIterator end() const { return ConstIterator(arr_ + arr_size_); }
+
+  bool Empty() const { return Size() == 0; }
+  SizeType Size() const { return arr_size_; }
+  // the most elements whose bytes can be counted in a SizeType
+  SizeType MaxSize() const {
+    return std::numeric_limits<SizeType>::max() / sizeof(T);
+  }
+  void Reserve(SizeType size);
+  SizeType Capacity() const { return capacity_; }
+  void ShrinkToFit();
+
+  void Clear() { Truncate(0); }
+  Iterator Insert(Iterator pos, ConstReference value) {
+    return Emplace(pos, value);
+  }
+  Iterator Insert(Iterator pos, SizeType count, ConstReference value);
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  Iterator Insert(Iterator pos, InputIt first, InputIt last);
+  void Erase(Iterator pos);
+  Iterator Erase(Iterator first, Iterator last);
+  template <typename Predicate>
+  SizeType EraseIf(Predicate pred);
+  void PushBack(ConstReference value) { Append(value); }
+  void PushBack(T&& value) { Append(std::move(value)); }
+  void PopBack() { std::destroy_at(arr_ + --arr_size_); }
+
+  template <class... Args>
+  Iterator Emplace(ConstIterator pos, Args&&... args);
+  template <class... Args>
+  void EmplaceBack(Args&&... args) {
+    Emplace(end(), std::forward<Args>(args)...);
+  }
+
+ protected:
+  using AllocatorTraits = std::allocator_traits<Allocator>;
+  using AllocatorBase::StoredAllocator;
+  using InlineBuffer<T, N>::InlineData;
+  VectorBase() {}
+  explicit VectorBase(const Allocator& allocator) : AllocatorBase(allocator) {}
+  ~VectorBase() { FreeVector(); }
+  // whether the elements are kept in the object itself, or nowhere yet
+  bool IsInline() const { return arr_ == InlineData(); }
+  void FreeVector();
+  SizeType arr_size_{0};
+  SizeType capacity_{N};
+  T* arr_{InlineData()};
+
+ private:
+  static constexpr bool kTriviallyRelocatable {
+      std::is_trivially_copyable_v<T> &&
+      alignof(T) <= alignof(std::max_align_t)};
+  // malloc storage stands in for the allocator only where nobody can tell
+  static constexpr bool kReallocatable {
+      kTriviallyRelocatable && std::is_same_v<Allocator, std::allocator<T>>};
+  T* Allocate(SizeType size);
+  void Deallocate(T* storage, SizeType size);
+  static void Relocate(T* first, T* last, T* destination);
+  SizeType GrownCapacity(SizeType size) const;
+  template <typename... Args>
+  void Append(Args&&... args);
+  template <typename... Args>
+  void GrowAndAppend(Args&&... args);
+  SizeType IndexOf(ConstIterator pos);
+  Iterator InsertMoved(SizeType index, T* source, SizeType count);
+  template <typename Put>
+  Iterator InsertGap(SizeType index, SizeType count, Put put);
+  void Truncate(SizeType size);
+  void ChangeCapacity(SizeType size);
+  void Reallocate(SizeType size);
+  void ReplaceStorage(T* storage, SizeType capacity);
+};
+
+template <typename T, typename Allocator, std::size_t N>
+class VectorBase<T, Allocator, N>::VectorIterator {
+ public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T*;
+  using reference = T&;
+  VectorIterator()
+      : ptr_ {nullptr} {}
+  explicit VectorIterator(T* ptr)
+      : ptr_ {ptr} {}
+  VectorIterator(const VectorIterator& other)
+      : ptr_ {other.ptr_} {}
+  VectorIterator(VectorIterator&& other) {
+    ptr_ = other.ptr_;
+    other.ptr_ = nullptr;
+  }
+  VectorIterator& operator=(const VectorIterator& other) {
+    ptr_ = other.ptr_;
+    return *this;
+  }
+  VectorIterator& operator=(VectorIterator&& other) {
+    ptr_ = other.ptr_;
+    return *this;
+  }
+  ~VectorIterator() {}
+  T& operator*() {
+    return *ptr_;
+  }
+  VectorIterator operator+(SizeType n) {
+      ptr_ += n;
+      return *this;
+  }
+  VectorIterator operator-(SizeType n) {
+      ptr_ -= n;
+      return *this;
+  }
+  VectorIterator& operator++() {
+    ++ptr_;
+    return *this;
+  }
+  VectorIterator&  operator--() {
+    --ptr_;
+    return *this;
+  }
+  VectorIterator operator++(int) {
+    VectorIterator temp {*this};
+    ++(*this);
+    return temp;
+  }
+  VectorIterator operator--(int) {
+    VectorIterator temp {*this};
+    --(*this);
+    return temp;
+  }
+  long long operator-(Iterator pos) const {
+    return ptr_ - pos.ptr_;
+  }
+  bool operator!=(const Iterator& other) const {
+    return ptr_ != other.ptr_;
+  }
+  bool operator==(const Iterator& other) const {
+    return ptr_ == other.ptr_;
+  }
+  bool operator>(Iterator const& other) const {
+    return (ptr_ - other.ptr_) > 0;
+  }
+  bool operator>=(Iterator const& other) const {
+    return (ptr_ - other.ptr_) >= 0;
+  }
+  bool operator<(Iterator const& other) const {
+    return (ptr_ - other.ptr_) < 0;
+  }
+  bool operator<=(Iterator const& other) const {
+    return (ptr_ - other.ptr_) <= 0;
+  }
+  operator ConstVectorIterator() const { return ConstVectorIterator(ptr_); }
+  T* ptr_ {nullptr};
+};
+
+template <typename T, typename Allocator, std::size_t N>
+class VectorBase<T, Allocator, N>::ConstVectorIterator {
+ public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = T;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const T*;
+  using reference = const T&;
+  ConstVectorIterator()
+      : ptr_ {nullptr} {}
+  explicit ConstVectorIterator(const T* ptr)
+      : ptr_ {ptr} {}
+  ConstVectorIterator(const ConstVectorIterator& other)
+      : ptr_ {other.ptr_} {}
+  ConstVectorIterator(ConstVectorIterator&& other) {
+    ptr_ = other.ptr_;
+    other.ptr_ = nullptr;
+  }
+  ConstVectorIterator& operator=(const ConstVectorIterator& other) {
+    ptr_ = other.ptr_;
+    return *this;
+  }
+  ConstVectorIterator& operator=(ConstVectorIterator&& other) {
+    ptr_ = other.ptr_;
+    return *this;
+  }
+  ~ConstVectorIterator() {}
+  const T& operator*() const {
+    return *ptr_;
+  }
+  ConstVectorIterator operator+(SizeType n) {
+      ptr_ += n;
+      return *this;
+  }
+  ConstVectorIterator operator-(SizeType n) {
+      ptr_ -= n;
+      return *this;
+  }
+  ConstVectorIterator& operator++() {
+    ++ptr_;
+    return *this;
+  }
+  ConstVectorIterator&  operator--() {
+    --ptr_;
+    return *this;
+  }
+  ConstVectorIterator operator++(int) {
+    ConstVectorIterator temp {*this};
+    ++(*this);
+    return temp;
+  }
+  ConstVectorIterator operator--(int) {
+    ConstVectorIterator temp {*this};
+    --(*this);
+    return temp;
+  }
+  long long operator-(ConstIterator pos) const {
+    return ptr_ - pos.ptr_;
+  }
+  bool operator!=(const ConstIterator& other) const {
+    return ptr_ != other.ptr_;
+  }
+  bool operator==(const ConstIterator& other) const {
+    return ptr_ == other.ptr_;
+  }
+  bool operator>(const Iterator& other) const {
+    return (ptr_ - other.ptr_) > 0;
+  }
+  bool operator>=(const Iterator& other) const {
+    return (ptr_ - other.ptr_) >= 0;
+  }
+  bool operator<(const Iterator& other) const {
+    return (ptr_ - other.ptr_) < 0;
+  }
+  bool operator<=(const Iterator& other) const {
+    return (ptr_ - other.ptr_) <= 0;
+  }
+  operator VectorIterator() const { return VectorIterator(ptr_); }
+  const T* ptr_ {nullptr};
+};
+
+template <typename T, typename Allocator, std::size_t N>
+T& VectorBase<T, Allocator, N>::At(SizeType pos) {
+  if (pos >= Size()) {
+    throw std::out_of_range("Index out of range");
+  }
+  return arr_[pos];
+}
+
+template <typename T, typename Allocator, std::size_t N>
+const T& VectorBase<T, Allocator, N>::At(SizeType pos) const {
+  if (pos >= Size()) {
+    throw std::out_of_range("Index out of range");
+  }
+  return arr_[pos];
+}
+
+template <typename T, typename Allocator, std::size_t N>
+T& VectorBase<T, Allocator, N>::Front() {
+  if (Empty()) {
+    throw std::out_of_range("Vector is empty");
+  }
+  return arr_[0];
+}
+
+template <typename T, typename Allocator, std::size_t N>
+T& VectorBase<T, Allocator, N>::Back() {
+  if (Empty()) {
+    throw std::out_of_range("Vector is empty");
+  }
+  return arr_[arr_size_ - 1];
+}
+
+template <typename T, typename Allocator, std::size_t N>
+const T& VectorBase<T, Allocator, N>::Front() const {
+  if (Empty()) {
+    throw std::out_of_range("Vector is empty");
+  }
+  return arr_[0];
+}
+
+template <typename T, typename Allocator, std::size_t N>
+const T& VectorBase<T, Allocator, N>::Back() const {
+  if (Empty()) {
+    throw std::out_of_range("Vector is empty");
+  }
+  return arr_[arr_size_ - 1];
+}
+
+template <typename T, typename Allocator, std::size_t N>
+void VectorBase<T, Allocator, N>::Reserve(SizeType size) {
+  if (size > MaxSize()) {
+    throw std::length_error("Vector is too large");
+  }
+  if (size > capacity_) {
+    ChangeCapacity(size);
+  }
+}
+
+template <typename T, typename Allocator, std::size_t N>
+void VectorBase<T, Allocator, N>::ShrinkToFit() {
+  if (capacity_ > arr_size_) {
+    ChangeCapacity(arr_size_);
+  }
+}
+
+template <typename T, typename Allocator, std::size_t N>
+typename VectorBase<T, Allocator, N>::Iterator
+VectorBase<T, Allocator, N>::Insert(Iterator pos, SizeType count,
+                                    const T& value) {
+  // value may be an element of this vector, so the one copy every new
+  // element is made from is taken before anything moves
+  SizeType index {IndexOf(pos)};
+  if (count == 0) {
+    return Iterator(arr_ + index);
+  }
+  T copy(value);
+  return InsertGap(index, count,
+                   [&copy](T* destination, SizeType, SizeType n, bool raw) {
+                     if (raw) {
+                       std::uninitialized_fill_n(destination, n, copy);
+                     } else {
+                       std::fill_n(destination, n, copy);
+                     }
+                   });
+}
+
+template <typename T, typename Allocator, std::size_t N>
+template <typename InputIt, typename>
+typename VectorBase<T, Allocator, N>::Iterator
+VectorBase<T, Allocator, N>::Insert(Iterator pos, InputIt first,
+                                    InputIt last) {
+  // the range may be part of this vector, and an input range can be read
+  // only once, so it is copied out before the tail moves
+  SizeType index {IndexOf(pos)};
+  VectorBase items(StoredAllocator());
+  if constexpr (IsForwardIterator<InputIt>::value) {
+    items.Reserve(static_cast<SizeType>(std::distance(first, last)));
+  }
+  for (; first != last; ++first) {
+    items.PushBack(*first);
+  }
+  return InsertMoved(index, items.arr_, items.arr_size_);
+}
+
+template <typename T, typename Allocator, std::size_t N>
+void VectorBase<T, Allocator, N>::Erase(Iterator pos) {
+  if (pos < begin() || pos >= end()) {
+    return;
+  }
+  Erase(pos, Iterator(pos.ptr_ + 1));
+}
+
+template <typename T, typename Allocator, std::size_t N>
+typename VectorBase<T, Allocator, N>::Iterator
+VectorBase<T, Allocator, N>::Erase(Iterator first, Iterator last) {
+  // the tail moves down once, over the whole range
+  if (first < begin() || last > end() || !(first < last)) {
+    return first;
+  }
+  SizeType erased {static_cast<SizeType>(last - first)};
+  if constexpr (kTriviallyRelocatable) {
+    std::memmove(static_cast<void*>(first.ptr_), last.ptr_,
+                 (end() - last) * sizeof(T));
+  } else {
+    std::move(last.ptr_, arr_ + arr_size_, first.ptr_);
+  }
+  Truncate(arr_size_ - erased);
+  return first;
+}
+
+template <typename T, typename Allocator, std::size_t N>
+template <typename Predicate>
+typename VectorBase<T, Allocator, N>::SizeType
+VectorBase<T, Allocator, N>::EraseIf(Predicate pred) {
+  // one pass moves the survivors down over the erased elements, in order
+  SizeType kept {0};
+  for (SizeType i {0}; i < arr_size_; ++i) {
+    if (pred(static_cast<const T&>(arr_[i]))) {
+      continue;
+    }
+    if (kept != i) {
+      arr_[kept] = std::move(arr_[i]);
+    }
+    ++kept;
+  }
+  SizeType erased {arr_size_ - kept};
+  Truncate(kept);
+  return erased;
+}
+
+template <typename T, typename Allocator, std::size_t N>
+template <typename... Args>
+typename VectorBase<T, Allocator, N>::Iterator
+VectorBase<T, Allocator, N>::Emplace(ConstIterator pos, Args&&... args) {
+  // every argument becomes one element, inserted in order before pos
+  SizeType index_of_pos {IndexOf(pos)};
+  const SizeType args_size {sizeof...(Args)};
+  if constexpr (args_size == 0) {
+    return Iterator(arr_ + index_of_pos);
+  } else {
+    // the arguments may refer to elements of this vector, so they are
+    // copied out before anything moves
+    ValueType args_data[args_size] {std::forward<Args>(args)...};
+    return InsertMoved(index_of_pos, args_data, args_size);
+  }
+}
+
+template <typename T, typename Allocator, std::size_t N>
+typename VectorBase<T, Allocator, N>::SizeType
+VectorBase<T, Allocator, N>::IndexOf(ConstIterator pos) {
+  if (pos < begin() || pos > end()) {
+    throw std::out_of_range("Position is out of array size");
+  }
+  return static_cast<SizeType>(pos - begin());
+}
+
+template <typename T, typename Allocator, std::size_t N>
+typename VectorBase<T, Allocator, N>::Iterator
+VectorBase<T, Allocator, N>::InsertMoved(SizeType index, T* source,
+                                         SizeType count) {
+  // moves count elements from source in before index
+  return InsertGap(index, count,
+                   [source](T* destination, SizeType offset, SizeType n,
+                            bool raw) {
+                     if (raw) {
+                       std::uninitialized_move(source + offset,
+                                               source + offset + n,
+                                               destination);
+                     } else {
+                       std::move(source + offset, source + offset + n,
+                                 destination);
+                     }
+                   });
+}
+
+template <typename T, typename Allocator, std::size_t N>
+template <typename Put>
+typename VectorBase<T, Allocator, N>::Iterator
+VectorBase<T, Allocator, N>::InsertGap(SizeType index, SizeType count,
+                                       Put put) {
+  // opens room for count elements before index, growing the storage at
+  // most once and shifting the tail once; put(destination, offset, n, raw)
+  // writes the new elements from offset to offset + n at destination,
+  // constructing them when raw and assigning over moved-from ones if not
+  if (count == 0) {
+    return Iterator(arr_ + index);
+  }
+  if (count > MaxSize() - arr_size_) {
+    throw std::length_error("Vector is too large");
+  }
+  if constexpr (kReallocatable) {
+    if (arr_size_ + count > capacity_) {
+      Reallocate(GrownCapacity(arr_size_ + count));
+    }
+  }
+  if (arr_size_ + count > capacity_) {
+    SizeType capacity {GrownCapacity(arr_size_ + count)};
+    T* storage {Allocate(capacity)};
+    SizeType built {0};
+    try {
+      Relocate(arr_, arr_ + index, storage);
+      built = index;
+      put(storage + index, 0, count, true);
+      built += count;
+      Relocate(arr_ + index, arr_ + arr_size_, storage + built);
+    } catch (...) {
+      std::destroy(storage, storage + built);
+      Deallocate(storage, capacity);
+      throw;
+    }
+    ReplaceStorage(storage, capacity);
+  } else {
+    T* position {arr_ + index};
+    T* last {arr_ + arr_size_};
+    SizeType shifted_elements {arr_size_ - index};
+    if constexpr (kTriviallyRelocatable) {
+      std::memmove(static_cast<void*>(position + count), position,
+                   shifted_elements * sizeof(T));
+      put(position, 0, count, true);
+    } else if (shifted_elements >= count) {
+      std::uninitialized_move(last - count, last, last);
+      std::move_backward(position, last - count, last);
+      put(position, 0, count, false);
+    } else {
+      std::uninitialized_move(position, last, position + count);
+      put(position, 0, shifted_elements, false);
+      put(last, shifted_elements, count - shifted_elements, true);
+    }
+  }
+  arr_size_ += count;
+  return Iterator(arr_ + index);
+}
+
+template <typename T, typename Allocator, std::size_t N>
+void VectorBase<T, Allocator, N>::Truncate(SizeType size) {
+  std::destroy(arr_ + size, arr_ + arr_size_);
+  arr_size_ = size;
+}
+
+template <typename T, typename Allocator, std::size_t N>
+T* VectorBase<T, Allocator, N>::Allocate(SizeType size) {
+  if (size == 0) {
+    return nullptr;
+  }
+  if (size > MaxSize()) {
+    throw std::length_error("Vector is too large");
+  }
+  if constexpr (kReallocatable) {
+    void* storage {std::malloc(size * sizeof(T))};
+    if (storage == nullptr) {
+      throw std::bad_alloc();
+    }
+    return static_cast<T*>(storage);
+  } else {
+    return AllocatorTraits::allocate(StoredAllocator(), size);
+  }
+}
+
+template <typename T, typename Allocator, std::size_t N>
+void VectorBase<T, Allocator, N>::Deallocate(T* storage, SizeType size) {
+  if (storage == InlineData()) {
+    return;
+  }
+  if constexpr (kReallocatable) {
+    std::free(storage);
+  } else {
+    AllocatorTraits::deallocate(StoredAllocator(), storage, size);
+  }
+}
+
+template <typename T, typename Allocator, std::size_t N>
+void VectorBase<T, Allocator, N>::Relocate(T* first, T* last,
+                                           T* destination) {
+  // builds the elements at destination, the originals are left in place
+  if constexpr (kTriviallyRelocatable) {
+    if (first != last) {
+      std::memcpy(static_cast<void*>(destination), first,
+                  (last - first) * sizeof(T));
+    }
+  } else if constexpr (std::is_nothrow_move_constructible_v<T> ||
+                       !std::is_copy_constructible_v<T>) {
+    std::uninitialized_move(first, last, destination);
+  } else {
+    std::uninitialized_copy(first, last, destination);
+  }
+}
+
+template <typename T, typename Allocator, std::size_t N>
+typename VectorBase<T, Allocator, N>::SizeType
+VectorBase<T, Allocator, N>::GrownCapacity(SizeType size) const {
+  // doubling stops at MaxSize, past which Allocate refuses anyway
+  if (capacity_ > MaxSize() / 2) {
+    return MaxSize() < size ? size : MaxSize();
+  }
+  SizeType capacity {capacity_ == 0 ? 1 : capacity_ * 2};
+  return capacity < size ? size : capacity;
+}
+
+template <typename T, typename Allocator, std::size_t N>
+template <typename... Args>
+void VectorBase<T, Allocator, N>::Append(Args&&... args) {
+  if (arr_size_ < capacity_) {
+    ::new (static_cast<void*>(arr_ + arr_size_))
+        T(std::forward<Args>(args)...);
+    ++arr_size_;
+  } else {
+    GrowAndAppend(std::forward<Args>(args)...);
+  }
+}
+
+template <typename T, typename Allocator, std::size_t N>
+template <typename... Args>
+void VectorBase<T, Allocator, N>::GrowAndAppend(Args&&... args) {
+  // the new element is built before the old ones move, as args may refer
+  // to one of them
+  if constexpr (kReallocatable) {
+    T value(std::forward<Args>(args)...);
+    Reallocate(GrownCapacity(arr_size_ + 1));
+    ::new (static_cast<void*>(arr_ + arr_size_)) T(value);
+    ++arr_size_;
+    return;
+  }
+  SizeType capacity {GrownCapacity(arr_size_ + 1)};
+  T* storage {Allocate(capacity)};
+  try {
+    ::new (static_cast<void*>(storage + arr_size_))
+        T(std::forward<Args>(args)...);
+  } catch (...) {
+    Deallocate(storage, capacity);
+    throw;
+  }
+  try {
+    Relocate(arr_, arr_ + arr_size_, storage);
+  } catch (...) {
+    std::destroy_at(storage + arr_size_);
+    Deallocate(storage, capacity);
+    throw;
+  }
+  ReplaceStorage(storage, capacity);
+  ++arr_size_;
+}
+
+template <typename T, typename Allocator, std::size_t N>
+void VectorBase<T, Allocator, N>::ChangeCapacity(SizeType size) {
+  // a size that fits inline sends the elements back into the object
+  if (size < arr_size_ || (size <= N && IsInline())) {
+    return;
+  }
+  if (size == 0) {
+    FreeVector();
+    return;
+  }
+  if constexpr (kReallocatable) {
+    if (size > N) {
+      Reallocate(size);
+      return;
+    }
+  }
+  SizeType capacity {size <= N ? N : size};
+  T* storage {size <= N ? InlineData() : Allocate(capacity)};
+  try {
+    Relocate(arr_, arr_ + arr_size_, storage);
+  } catch (...) {
+    Deallocate(storage, capacity);
+    throw;
+  }
+  ReplaceStorage(storage, capacity);
+}
+
+template <typename T, typename Allocator, std::size_t N>
+void VectorBase<T, Allocator, N>::Reallocate(SizeType size) {
+  // only for malloc storage, whose elements realloc may move; elements
+  // still inline are copied out to a new block instead
+  if (IsInline()) {
+    T* storage {Allocate(size)};
+    Relocate(arr_, arr_ + arr_size_, storage);
+    arr_ = storage;
+    capacity_ = size;
+    return;
+  }
+  if (size > MaxSize()) {
+    throw std::length_error("Vector is too large");
+  }
+  void* storage {std::realloc(arr_, size * sizeof(T))};
+  if (storage == nullptr) {
+    throw std::bad_alloc();
+  }
+  arr_ = static_cast<T*>(storage);
+  capacity_ = size;
+}
+
+template <typename T, typename Allocator, std::size_t N>
+void VectorBase<T, Allocator, N>::ReplaceStorage(T* storage,
+                                                 SizeType capacity) {
+  // the elements already live in storage, the old copies are dropped
+  std::destroy(arr_, arr_ + arr_size_);
+  Deallocate(arr_, capacity_);
+  arr_ = storage;
+  capacity_ = capacity;
+}
+
+template <typename T, typename Allocator, std::size_t N>
+void VectorBase<T, Allocator, N>::FreeVector() {
+  std::destroy(arr_, arr_ + arr_size_);
+  Deallocate(arr_, capacity_);
+  arr_ = InlineData();
+  capacity_ = N;
+  arr_size_ = 0;
+}
+
+}  // namespace s21
+
+#endif  // SRC_VECTOR_BASE_H_